@@ -0,0 +1,217 @@
+#include "Dataset.hpp"
+#include "FitData.hpp"
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Check that the steady-state track fit does not allocate: the global
+// operator new and (with glibc) malloc are replaced by versions counting the
+// allocations of the calling thread while the counting is enabled. The
+// counting is enabled only around the fit of a track, after a warmup pass
+// over all tracks.
+
+namespace {
+// The allocation counting of the calling thread
+thread_local bool t_countAllocations = false;
+thread_local size_t t_nAllocations = 0;
+thread_local size_t t_nBytes = 0;
+
+inline void countAllocation(size_t size) {
+  if (t_countAllocations) {
+    ++t_nAllocations;
+    t_nBytes += size;
+  }
+}
+} // namespace
+
+#ifdef __GLIBC__
+// The glibc allocator behind the replaced malloc
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *ptr);
+
+void *malloc(size_t size) {
+  countAllocation(size);
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+  countAllocation(n * size);
+  return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+  countAllocation(size);
+  return __libc_realloc(ptr, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+  countAllocation(size);
+  return __libc_memalign(alignment, size);
+}
+
+void *memalign(size_t alignment, size_t size) {
+  countAllocation(size);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size) {
+  countAllocation(size);
+  *ptr = __libc_memalign(alignment, size);
+  return *ptr == nullptr ? ENOMEM : 0;
+}
+}
+
+static void *rawAllocate(size_t size) { return __libc_malloc(size); }
+static void rawFree(void *ptr) { __libc_free(ptr); }
+#else
+// Only the allocations with operator new are counted
+static void *rawAllocate(size_t size) { return std::malloc(size); }
+static void rawFree(void *ptr) { std::free(ptr); }
+#endif
+
+void *operator new(size_t size) {
+  countAllocation(size);
+  void *ptr = rawAllocate(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  countAllocation(size);
+  return rawAllocate(size == 0 ? 1 : size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept {
+  return operator new(size, tag);
+}
+
+void operator delete(void *ptr) noexcept { rawFree(ptr); }
+void operator delete[](void *ptr) noexcept { rawFree(ptr); }
+void operator delete(void *ptr, size_t) noexcept { rawFree(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { rawFree(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  rawFree(ptr);
+}
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  rawFree(ptr);
+}
+
+static void show_usage(std::string name) {
+  std::cerr << "Usage: <option(s)> VALUES"
+            << "Options:\n"
+            << "\t-h,--help\t\tShow this help message\n"
+            << "\t-t,--tracks \tSpecify the number of tracks\n"
+            << "\t-r,--threads \tSpecify the number of threads\n"
+            << "\t-c,--chunk \tSpecify the number of tracks per work chunk\n"
+            << "\t-m,--smoothing \tIndicator for running smoothing\n"
+            << "\t-d,--direct \tIndicator for extrapolating the smoothed "
+               "parameters directly to the target\n"
+            << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  unsigned int nTracks = 1000;
+  unsigned int nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  unsigned int chunkSize = 16;
+  bool smoothing = true;
+  bool directExtrapolation = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if ((arg == "-h") or (arg == "--help")) {
+      show_usage(argv[0]);
+      return 0;
+    } else if (i + 1 < argc) {
+      if ((arg == "-t") or (arg == "--tracks")) {
+        nTracks = atoi(argv[++i]);
+      } else if ((arg == "-r") or (arg == "--threads")) {
+        nThreads = atoi(argv[++i]);
+      } else if ((arg == "-c") or (arg == "--chunk")) {
+        chunkSize = atoi(argv[++i]);
+      } else if ((arg == "-m") or (arg == "--smoothing")) {
+        smoothing = (atoi(argv[++i]) == 1);
+      } else if ((arg == "-d") or (arg == "--direct")) {
+        directExtrapolation = (atoi(argv[++i]) == 1);
+      } else {
+        std::cerr << "Unknown argument." << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  // Create a random number service
+  ActsExamples::RandomNumbers::Config config;
+  auto randomNumbers = std::make_shared<ActsExamples::RandomNumbers>(config);
+  auto rng = randomNumbers->spawnGenerator(0);
+
+  // Create a test context
+  Acts::GeometryContext gctx;
+  Acts::MagneticFieldContext mctx;
+
+  // Create the geometry, run the simulation and the smearing
+  FitDataset data;
+  buildDataset(gctx, mctx, rng, nTracks, data);
+  const size_t nSurfaces = data.nSurfaces;
+
+  WorkStealingPool pool(nThreads, chunkSize);
+  KalmanFitterType kFitter(FitPropagatorType{Stepper()});
+  std::vector<TSType> fittedStates(nSurfaces * nTracks);
+  // The allocations counted per worker
+  std::vector<size_t> nAllocations(pool.nWorkers(), 0);
+  std::vector<size_t> nBytes(pool.nWorkers(), 0);
+  std::vector<size_t> nAllocatingFits(pool.nWorkers(), 0);
+
+  // The warmup pass is not counted, e.g. for lazily allocated statics
+  auto fitAll = [&](bool count) {
+    pool.run(nTracks, [&](size_t it, unsigned int worker) {
+      KalmanFitterResultType kfResult;
+      t_nAllocations = 0;
+      t_nBytes = 0;
+      t_countAllocations = count;
+      fitTrack(kFitter, gctx, mctx, data, it, smoothing,
+               fittedStates.data() + it * nSurfaces, kfResult,
+               directExtrapolation);
+      t_countAllocations = false;
+      if (t_nAllocations > 0) {
+        nAllocations[worker] += t_nAllocations;
+        nBytes[worker] += t_nBytes;
+        nAllocatingFits[worker]++;
+      }
+    });
+  };
+  fitAll(false);
+  fitAll(true);
+
+  size_t totalAllocations = 0;
+  size_t totalBytes = 0;
+  size_t totalAllocatingFits = 0;
+  for (unsigned int iw = 0; iw < pool.nWorkers(); ++iw) {
+    totalAllocations += nAllocations[iw];
+    totalBytes += nBytes[iw];
+    totalAllocatingFits += nAllocatingFits[iw];
+  }
+  std::cout << "INFO: " << totalAllocations << " allocations (" << totalBytes
+            << " bytes) in " << totalAllocatingFits << " of " << nTracks
+            << " fits with " << pool.nWorkers() << " threads" << std::endl;
+  if (totalAllocations > 0) {
+    std::cout << "ERROR: The track fit allocates after the warmup"
+              << std::endl;
+    return 1;
+  }
+  std::cout << "------------------------  ending  -----------------------"
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,292 @@
+#include "Dataset.hpp"
+#include "FitData.hpp"
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#ifndef ACTS_GIT_HASH
+#define ACTS_GIT_HASH "unknown"
+#endif
+#ifndef ACTS_BUILD_TYPE
+#define ACTS_BUILD_TYPE "unknown"
+#endif
+
+static void show_usage(std::string name) {
+  std::cerr << "Usage: <option(s)> VALUES"
+            << "Options:\n"
+            << "\t-h,--help\t\tShow this help message\n"
+            << "\t-t,--tracks \tComma-separated numbers of tracks\n"
+            << "\t-r,--threads \tComma-separated numbers of threads\n"
+            << "\t-m,--smoothing \tComma-separated smoothing indicators\n"
+            << "\t-d,--direct \tComma-separated indicators for the direct "
+               "extrapolation to the target\n"
+            << "\t-p,--mixed \tComma-separated indicators for the covariance "
+               "update and smoothing in double precision\n"
+            << "\t-w,--warmup \tSpecify the number of warmup runs\n"
+            << "\t-n,--repetitions \tSpecify the number of timed runs\n"
+            << "\t-c,--chunk \tSpecify the number of tracks per work chunk\n"
+            << "\t-f,--file \tThe name of the results file\n"
+            << "\t-a,--machine \tThe name of the machine, e.g. V100\n"
+            << std::endl;
+}
+
+static std::vector<unsigned int> parseList(const std::string &arg) {
+  std::vector<unsigned int> values;
+  std::stringstream ss(arg);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    if (not item.empty()) {
+      values.push_back(std::stoul(item));
+    }
+  }
+  return values;
+}
+
+// The first "model name" of /proc/cpuinfo
+static std::string cpuModel() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.compare(0, 10, "model name") == 0) {
+      auto pos = line.find(':');
+      if (pos != std::string::npos) {
+        return line.substr(line.find_first_not_of(' ', pos + 1));
+      }
+    }
+  }
+  return "unknown";
+}
+
+static std::string hostName() {
+  char name[256] = {};
+  if (gethostname(name, sizeof(name) - 1) != 0) {
+    return "unknown";
+  }
+  return name;
+}
+
+// Escape a string for the json output
+static std::string quote(const std::string &s) {
+  std::string quoted = "\"";
+  for (char c : s) {
+    if (c == '"' or c == '\\') {
+      quoted += '\\';
+    }
+    quoted += c;
+  }
+  return quoted + "\"";
+}
+
+// The nearest-rank percentile of the sorted times
+static double percentile(const std::vector<double> &sorted, double fraction) {
+  size_t rank = std::ceil(fraction * sorted.size());
+  return sorted[std::min(std::max(rank, size_t(1)), sorted.size()) - 1];
+}
+
+int main(int argc, char *argv[]) {
+  std::vector<unsigned int> tracksList = {10000};
+  std::vector<unsigned int> threadsList = {
+      std::max(std::thread::hardware_concurrency(), 1u)};
+  std::vector<unsigned int> smoothingList = {1};
+  std::vector<unsigned int> directList = {0};
+  std::vector<unsigned int> mixedList = {0};
+  unsigned int nWarmup = 2;
+  unsigned int nRepetitions = 10;
+  unsigned int chunkSize = 16;
+  std::string machine;
+  std::string fileName;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if ((arg == "-h") or (arg == "--help")) {
+      show_usage(argv[0]);
+      return 0;
+    } else if (i + 1 < argc) {
+      if ((arg == "-t") or (arg == "--tracks")) {
+        tracksList = parseList(argv[++i]);
+      } else if ((arg == "-r") or (arg == "--threads")) {
+        threadsList = parseList(argv[++i]);
+      } else if ((arg == "-m") or (arg == "--smoothing")) {
+        smoothingList = parseList(argv[++i]);
+      } else if ((arg == "-d") or (arg == "--direct")) {
+        directList = parseList(argv[++i]);
+      } else if ((arg == "-p") or (arg == "--mixed")) {
+        mixedList = parseList(argv[++i]);
+      } else if ((arg == "-w") or (arg == "--warmup")) {
+        nWarmup = atoi(argv[++i]);
+      } else if ((arg == "-n") or (arg == "--repetitions")) {
+        nRepetitions = std::max(atoi(argv[++i]), 1);
+      } else if ((arg == "-c") or (arg == "--chunk")) {
+        chunkSize = atoi(argv[++i]);
+      } else if ((arg == "-f") or (arg == "--file")) {
+        fileName = argv[++i];
+      } else if ((arg == "-a") or (arg == "--machine")) {
+        machine = argv[++i];
+      } else {
+        std::cerr << "Unknown argument." << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  if (machine.empty()) {
+    std::cout << "ERROR: The name of the CPU being tested must be provided, "
+                 "like e.g. "
+                 "-a Intel_i7-8559U."
+              << std::endl;
+    return 1;
+  }
+  if (tracksList.empty() or threadsList.empty() or smoothingList.empty() or
+      directList.empty() or mixedList.empty()) {
+    std::cout << "ERROR: Empty list of tracks, threads, smoothing, direct "
+                 "extrapolation or mixed precision."
+              << std::endl;
+    return 1;
+  }
+  if (fileName.empty()) {
+    fileName = "bench_" + machine + ".json";
+  }
+
+  bool doublePrecision = std::is_same<ActsScalar, double>::value;
+  std::string precision = doublePrecision ? "double" : "float";
+  std::cout << "INFO: " << precision << " precision operand used."
+            << std::endl;
+
+  // Create a random number service
+  ActsExamples::RandomNumbers::Config config;
+  auto randomNumbers = std::make_shared<ActsExamples::RandomNumbers>(config);
+  auto rng = randomNumbers->spawnGenerator(0);
+
+  // Create a test context
+  Acts::GeometryContext gctx;
+  Acts::MagneticFieldContext mctx;
+
+  // Build the dataset once for the largest number of tracks, the smaller
+  // configurations fit the first tracks of it
+  const unsigned int maxTracks =
+      *std::max_element(tracksList.begin(), tracksList.end());
+  FitDataset data;
+  buildDataset(gctx, mctx, rng, maxTracks, data);
+
+  KalmanFitterType kFitter(FitPropagatorType{Stepper()});
+  MixedKalmanFitterType mixedFitter(FitPropagatorType{Stepper()});
+  std::vector<TSType> fittedStates(data.nSurfaces * maxTracks);
+  std::unique_ptr<bool[]> fitStatus(new bool[maxTracks]());
+
+  std::ofstream results(fileName);
+  results << "{\n  \"schema\": \"kf-cpu-bench/1\",\n";
+  results << "  \"host\": {\"machine\": " << quote(machine)
+          << ", \"hostname\": " << quote(hostName())
+          << ", \"cpu\": " << quote(cpuModel())
+          << ", \"hardware_concurrency\": "
+          << std::thread::hardware_concurrency() << "},\n";
+  results << "  \"build\": {\"git\": " << quote(ACTS_GIT_HASH)
+          << ", \"build_type\": " << quote(ACTS_BUILD_TYPE)
+          << ", \"compiler\": " << quote(__VERSION__)
+          << ", \"precision\": " << quote(precision) << "},\n";
+  results << "  \"date\": " << std::time(nullptr) << ",\n";
+  results << "  \"runs\": [";
+
+  // One pool per number of threads, kept over all configurations
+  std::vector<std::unique_ptr<WorkStealingPool>> pools;
+  for (unsigned int nThreads : threadsList) {
+    pools.emplace_back(new WorkStealingPool(nThreads, chunkSize));
+  }
+
+  bool firstRun = true;
+  for (unsigned int nTracks : tracksList) {
+    for (auto &threadsPool : pools) {
+      WorkStealingPool &pool = *threadsPool;
+      for (unsigned int smoothing : smoothingList) {
+        for (unsigned int direct : directList) {
+          for (unsigned int mixed : mixedList) {
+            auto runFitWith = [&](const auto &fitter) {
+              pool.run(nTracks, [&](size_t it, unsigned int /*worker*/) {
+                KalmanFitterResultType kfResult;
+                fitStatus[it] = fitTrack(
+                    fitter, gctx, mctx, data, it, smoothing == 1,
+                    fittedStates.data() + it * data.nSurfaces, kfResult,
+                    direct == 1);
+              });
+            };
+            auto runFit = [&]() {
+              if (mixed == 1) {
+                runFitWith(mixedFitter);
+              } else {
+                runFitWith(kFitter);
+              }
+            };
+
+            for (unsigned int iw = 0; iw < nWarmup; ++iw) {
+              runFit();
+            }
+            std::vector<double> times;
+            for (unsigned int ir = 0; ir < nRepetitions; ++ir) {
+              auto start = std::chrono::high_resolution_clock::now();
+              runFit();
+              auto end = std::chrono::high_resolution_clock::now();
+              times.push_back(std::chrono::duration<double, std::milli>(
+                                  end - start)
+                                  .count());
+            }
+            unsigned int nFailed =
+                std::count(fitStatus.get(), fitStatus.get() + nTracks, false);
+
+            std::vector<double> sorted = times;
+            std::sort(sorted.begin(), sorted.end());
+            const double median = percentile(sorted, 0.5);
+            const double tracksPerSecond = nTracks / (median * 1e-3);
+            std::cout << "INFO: tracks " << nTracks << ", threads "
+                      << pool.nWorkers() << ", smoothing " << smoothing
+                      << ", direct " << direct << ", mixed " << mixed
+                      << ": min/median/p90/p99 (ms) " << sorted.front() << "/"
+                      << median << "/" << percentile(sorted, 0.9) << "/"
+                      << percentile(sorted, 0.99) << ", tracks/s "
+                      << tracksPerSecond << std::endl;
+
+            results << (firstRun ? "\n" : ",\n");
+            results << "    {\"tracks\": " << nTracks
+                    << ", \"threads\": " << pool.nWorkers()
+                    << ", \"smoothing\": "
+                    << (smoothing == 1 ? "true" : "false")
+                    << ", \"direct_extrapolation\": "
+                    << (direct == 1 ? "true" : "false")
+                    << ", \"precision\": " << quote(precision)
+                    << ", \"mixed_precision\": "
+                    << (mixed == 1 ? "true" : "false")
+                    << ", \"chunk\": " << chunkSize
+                    << ", \"warmup\": " << nWarmup
+                    << ", \"repetitions\": " << nRepetitions
+                    << ", \"failed\": " << nFailed
+                    << ", \"min_ms\": " << sorted.front()
+                    << ", \"median_ms\": " << median
+                    << ", \"p90_ms\": " << percentile(sorted, 0.9)
+                    << ", \"p99_ms\": " << percentile(sorted, 0.99)
+                    << ", \"tracks_per_s\": " << tracksPerSecond
+                    << ", \"times_ms\": [";
+            for (size_t i = 0; i < times.size(); ++i) {
+              results << (i == 0 ? "" : ", ") << times[i];
+            }
+            results << "]}";
+            firstRun = false;
+          }
+        }
+      }
+    }
+  }
+  results << "\n  ]\n}\n";
+  std::cout << "INFO: Writing benchmark results to " << fileName << std::endl;
+
+  return 0;
+}
@@ -1,22 +1,19 @@
+#include "Dataset.hpp"
 #include "FitData.hpp"
-#include "Processor.hpp"
+#include "WorkStealingPool.hpp"
 #include "Writer.hpp"
 
-#include "Material/HomogeneousSurfaceMaterial.hpp"
-
-#include "ActsExamples/MultiplicityGenerators.hpp"
-#include "ActsExamples/ParametricParticleGenerator.hpp"
-#include "ActsExamples/VertexGenerators.hpp"
-
-#include "Test/Helper.hpp"
 #include "Test/Logger.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 static void show_usage(std::string name) {
@@ -26,16 +23,31 @@ static void show_usage(std::string name) {
             << "\t-t,--tracks \tSpecify the number of tracks\n"
             << "\t-o,--output \tIndicator for writing propagation results\n"
             << "\t-r,--threads \tSpecify the number of threads\n"
+            << "\t-c,--chunk \tSpecify the number of tracks per work chunk\n"
             << "\t-m,--smoothing \tIndicator for running smoothing\n"
+            << "\t-d,--direct \tIndicator for extrapolating the smoothed "
+               "parameters directly to the target\n"
             << "\t-a,--machine \tThe name of the machine, e.g. V100\n"
+            << "\t-g,--chrome-trace \tIndicator for writing a Chrome trace "
+               "(requires ACTS_CPU_PROFILING)\n"
+            << "\t-f,--fallback \tIndicator for refitting the failed tracks "
+               "with the covariance computations in double precision\n"
+            << "\t-b,--batch \tIndicator for smoothing groups of tracks at "
+               "once with one SIMD lane per track (the work chunks are "
+               "counted in groups)\n"
             << std::endl;
 }
 
 int main(int argc, char *argv[]) {
   unsigned int nTracks = 10000;
-  unsigned int nThreads = 250;
+  unsigned int nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  unsigned int chunkSize = 16;
   bool output = false;
   bool smoothing = true;
+  bool directExtrapolation = false;
+  bool chromeTrace = false;
+  bool fallback = false;
+  bool batchSmoothing = false;
   std::string device;
   std::string machine;
   std::string bFieldFileName;
@@ -52,10 +64,20 @@ int main(int argc, char *argv[]) {
         output = (atoi(argv[++i]) == 1);
       } else if ((arg == "-r") or (arg == "--threads")) {
         nThreads = atoi(argv[++i]);
+      } else if ((arg == "-c") or (arg == "--chunk")) {
+        chunkSize = atoi(argv[++i]);
       } else if ((arg == "-m") or (arg == "--smoothing")) {
         smoothing = (atoi(argv[++i]) == 1);
+      } else if ((arg == "-d") or (arg == "--direct")) {
+        directExtrapolation = (atoi(argv[++i]) == 1);
       } else if ((arg == "-a") or (arg == "--machine")) {
         machine = argv[++i];
+      } else if ((arg == "-g") or (arg == "--chrome-trace")) {
+        chromeTrace = (atoi(argv[++i]) == 1);
+      } else if ((arg == "-f") or (arg == "--fallback")) {
+        fallback = (atoi(argv[++i]) == 1);
+      } else if ((arg == "-b") or (arg == "--batch")) {
+        batchSmoothing = (atoi(argv[++i]) == 1);
       } else {
         std::cerr << "Unknown argument." << std::endl;
         return 1;
@@ -84,140 +106,200 @@ int main(int argc, char *argv[]) {
   Acts::GeometryContext gctx;
   Acts::MagneticFieldContext mctx;
 
-  // Create the geometry
-  size_t nSurfaces = 10;
-  // Set translation vectors
-  std::vector<Acts::Vector3D> translations;
-  for (unsigned int isur = 0; isur < nSurfaces; isur++) {
-    Acts::Vector3D translation(isur * 30. + 20., 0., 0.);
-    translations.emplace_back(translation);
-  }
-  // The silicon material
-  Acts::MaterialSlab matProp(Test::makeSilicon(), 0.5 * Acts::units::_mm);
-  Acts::HomogeneousSurfaceMaterial surfaceMaterial(matProp);
-  // Create plane surfaces without boundaries
-  std::vector<PlaneSurfaceType> surfaces;
-  for (unsigned int isur = 0; isur < nSurfaces; isur++) {
-    surfaces.push_back(PlaneSurfaceType(
-        translations[isur], Acts::Vector3D(1, 0, 0), surfaceMaterial));
-  }
-  const Acts::Surface *surfacePtrs = surfaces.data();
-  std::cout << "INFO: Creating " << surfaces.size()
-            << " boundless plane surfaces" << std::endl;
-
-  // Assign the geometry ID
-  for (Size isur = 0; isur < nSurfaces; isur++) {
-    auto geoID = Acts::GeometryID()
-                     .setVolume(0u)
-                     .setLayer((uint64_t)(isur))
-                     .setSensitive((uint64_t)(isur));
-    surfaces[isur].assignGeoID(geoID);
-  }
-
-  // Prepare to run the particles generation
-  ActsExamples::GaussianVertexGenerator vertexGen;
-  vertexGen.stddev[Acts::eFreePos0] = 20.0 * Acts::units::_um;
-  vertexGen.stddev[Acts::eFreePos1] = 20.0 * Acts::units::_um;
-  vertexGen.stddev[Acts::eFreePos2] = 50.0 * Acts::units::_um;
-  vertexGen.stddev[Acts::eFreeTime] = 1.0 * Acts::units::_ns;
-  ActsExamples::ParametricParticleGenerator::Config pgCfg;
-  // @note We are generating 20% more particles to make sure we could get enough
-  // valid particles
-  size_t nGeneratedParticles = nTracks * 1.2;
-  ActsExamples::Generator generator = ActsExamples::Generator{
-      ActsExamples::FixedMultiplicityGenerator{nGeneratedParticles},
-      std::move(vertexGen), ActsExamples::ParametricParticleGenerator(pgCfg)};
-  // Run the generation to generate particles
-  std::vector<ActsFatras::Particle> generatedParticles;
-  runParticleGeneration(rng, generator, generatedParticles);
-
-  // Prepare to run the simulation
-  Stepper stepper;
-  PropagatorType propagator(stepper);
-  std::vector<ActsFatras::Particle> validParticles(nTracks);
-  std::vector<Simulator::result_type> simResult(nTracks);
-  auto start_propagate = std::chrono::high_resolution_clock::now();
-  // Run the simulation to generate sim hits
-  // @note We will pick up the valid particles
-  runSimulation(gctx, mctx, rng, propagator, generatedParticles, validParticles,
-                simResult, surfacePtrs, nSurfaces);
-  auto end_propagate = std::chrono::high_resolution_clock::now();
-  std::chrono::duration<double> elapsed_seconds =
-      end_propagate - start_propagate;
-  std::cout << std::endl;
-  std::cout << "INFO: Time (ms) to run simulation: "
-            << elapsed_seconds.count() * 1000 << std::endl;
+  // Create the geometry, run the simulation and the smearing
+  FitDataset data;
+  buildDataset(gctx, mctx, rng, nTracks, data);
+  const size_t nSurfaces = data.nSurfaces;
   if (output) {
     std::string simFileName =
         "sim_hits_for_" + std::to_string(nTracks) + "_particles.obj";
     std::cout << "INFO: Writing simulation results to " << simFileName
               << std::endl;
-    writeSimHitsObj(simResult, simFileName);
+    writeSimHitsObj(data.simHits, simFileName);
   }
 
-  // Build the target surfaces based on the truth particle position
-  std::vector<Acts::LineSurface> targetSurfaces(nTracks);
-  buildTargetSurfaces(validParticles, targetSurfaces.data());
-
-  // The hit smearing resolution
-  std::array<ActsScalar, 2> hitResolution = {50. * Acts::units::_um,
-                                             50. * Acts::units::_um};
-  // Run sim hits smearing to create source links
-  std::vector<Acts::PixelSourceLink> sourcelinks(nTracks * nSurfaces);
-  // @note pass the concreate PlaneSurfaceType pointer here
-  runHitSmearing(gctx, rng, simResult, hitResolution, sourcelinks.data(),
-                 surfaces.data(), nSurfaces);
-
-  // The particle smearing resolution
-  ParticleSmearingParameters seedResolution;
-  // Run truth seed smearing to create starting parameters with provided
-  // reference surface
-  auto startPars =
-      runParticleSmearing(rng, gctx, validParticles, seedResolution,
-                          targetSurfaces.data(), nTracks);
+  // The work-stealing pool running the fit over chunks of tracks
+  WorkStealingPool pool(nThreads, chunkSize);
 
   // Prepare to perform fit to the created tracks
-  KalmanFitterType kFitter(propagator);
-  std::vector<TSType> fittedStates(nSurfaces * nTracks);
+  KalmanFitterType kFitter(FitPropagatorType{Stepper()});
+  FallbackKalmanFitterType fallbackFitter(
+      FallbackPropagatorType{FallbackStepper()});
+  // The smoother of groups of tracks, used only if smoothing is run
+  BatchedSmoother batchedSmoother;
+  batchSmoothing = batchSmoothing and smoothing;
+  const size_t nGroups = (nTracks + s_batchSize - 1) / s_batchSize;
+  // The track states of the track (or group of tracks) being fitted by each
+  // worker
+  const size_t nWorkerStates =
+      batchSmoothing ? s_batchSize * nSurfaces : nSurfaces;
+  std::vector<TSType> workerStates(nWorkerStates * pool.nWorkers());
+  // The fitted states of all tracks are stored in the compact layout
+  std::vector<Acts::CompactTrackState> fittedStates(nSurfaces * nTracks);
+  std::cout << "INFO: Stored track states use "
+            << sizeof(Acts::CompactTrackState) * nSurfaces
+            << " bytes per track (" << sizeof(TSType) * nSurfaces
+            << " bytes as TrackState)" << std::endl;
   std::vector<Acts::BoundParameters<Acts::LineSurface>> fittedParams(nTracks);
-  bool fitStatus[nTracks];
+  // @note The status is kept on the heap as it could be too large for the
+  // stack with O(1M) tracks
+  std::unique_ptr<bool[]> fitStatus(new bool[nTracks]());
+  // The propagation counters per track
+  std::vector<Acts::PropagatorStatistics> propStats(nTracks);
 
-  int threads = 1;
-  auto start_fit = std::chrono::high_resolution_clock::now();
-// #pragma omp parallel for num_threads(nThreads)
-  for (int it = 0; it < nTracks; it++) {
-    std::cout << "track id: " << it << std::endl;
-    // The fit result wrapper
-    KalmanFitterResultType kfResult;
-    kfResult.fittedStates = Acts::CudaKernelContainer<TSType>(
-        fittedStates.data() + it * nSurfaces, nSurfaces);
-    // The input source links wrapper
-    auto sourcelinkTrack = Acts::CudaKernelContainer<Acts::PixelSourceLink>(
-        sourcelinks.data() + it * nSurfaces, nSurfaces);
-    FitOptionsType kfOptions(gctx, mctx, smoothing);
-    kfOptions.referenceSurface = &startPars[it].referenceSurface();
-    // Run the fit. The fittedStates will be changed here
-    auto status = kFitter.fit(sourcelinkTrack, startPars[it], kfOptions,
-                              kfResult, surfacePtrs, nSurfaces);
-    std::cout << "\n" << std::endl;
-    // if (not status) {
-    //  std::cout << "WARNING: fit failure for track " << it << std::endl;
-    //}
+#ifdef ACTS_CPU_PROFILING
+  Acts::detail::Profiler::enableTrace(chromeTrace);
+#else
+  if (chromeTrace) {
+    std::cout << "WARNING: No Chrome trace is written as the profiling is "
+                 "disabled (requires ACTS_CPU_PROFILING)"
+              << std::endl;
+  }
+#endif
+
+  // The propagation counters aggregated per thread, of the first fits and of
+  // the refits
+  std::vector<Acts::PropagatorBatchStatistics> batchStats(pool.nWorkers());
+  std::vector<Acts::PropagatorBatchStatistics> fallbackStats(pool.nWorkers());
+  // Store the fitted states and parameters of a track
+  auto store = [&](size_t it, bool status, const TSType *trackStates,
+                   const KalmanFitterResultType &kfResult, bool refit) {
+    // With the fallback, a fit with non-finite result counts as failed
+    if (fallback and status) {
+      status = isFitFinite(kfResult);
+    }
+    if (status) {
+      storeTrackStates(data, it, trackStates,
+                       fittedStates.data() + it * nSurfaces);
+    }
 
     // Store the fit parameters and status
     fitStatus[it] = status;
     fittedParams[it] = kfResult.fittedParameters;
-    // std::cout << "fitted status is: " << status << std::endl;
-    // std::cout << "fitted parameters are: " << kfResult.fittedParameters << std::endl;
-    // threads = omp_get_num_threads();
+    // The counters of a refitted track are those of both fits
+    if (refit) {
+      propStats[it] += kfResult.statistics;
+    } else {
+      propStats[it] = kfResult.statistics;
+    }
+    return kfResult.statistics;
+  };
+  // Fit a track and store the fitted states and parameters
+  auto fitAndStore = [&](const auto &fitter, size_t it, unsigned int worker,
+                         bool refit) {
+    KalmanFitterResultType kfResult;
+    TSType *trackStates = workerStates.data() + worker * nWorkerStates;
+    auto status = fitTrack(fitter, gctx, mctx, data, it, smoothing,
+                           trackStates, kfResult, directExtrapolation);
+    return store(it, status, trackStates, kfResult, refit);
+  };
+  // Fit a group of tracks smoothed at once and store the fitted states and
+  // parameters
+  auto fitAndStoreGroup = [&](size_t ig, unsigned int worker) {
+    const size_t firstTrack = ig * s_batchSize;
+    const size_t nGroupTracks =
+        std::min<size_t>(s_batchSize, nTracks - firstTrack);
+    KalmanFitterResultType kfResults[s_batchSize];
+    bool status[s_batchSize];
+    TSType *groupStates = workerStates.data() + worker * nWorkerStates;
+    fitTrackGroup(kFitter, batchedSmoother, gctx, mctx, data, firstTrack,
+                  nGroupTracks, groupStates, kfResults, status);
+    for (size_t l = 0; l < nGroupTracks; ++l) {
+      batchStats[worker].add(store(firstTrack + l, status[l],
+                                   groupStates + l * nSurfaces,
+                                   kfResults[l], false));
+    }
+  };
+
+  auto start_fit = std::chrono::high_resolution_clock::now();
+  if (batchSmoothing) {
+    pool.run(nGroups, fitAndStoreGroup);
+  } else {
+    pool.run(nTracks, [&](size_t it, unsigned int worker) {
+      batchStats[worker].add(fitAndStore(kFitter, it, worker, false));
+    });
+  }
+  // The number of threads which actually did the fitting
+  unsigned int threads = pool.nActiveWorkers();
+  const std::vector<WorkerStats> workerStats = pool.stats();
+
+  // Refit the tracks which failed numerically, e.g. due to a covariance which
+  // is not positive definite in float precision
+  std::vector<size_t> fallbackTracks;
+  if (fallback) {
+    for (size_t it = 0; it < nTracks; ++it) {
+      if (not fitStatus[it]) {
+        fallbackTracks.push_back(it);
+      }
+    }
+  }
+  auto start_fallback = std::chrono::high_resolution_clock::now();
+  if (not fallbackTracks.empty()) {
+    pool.run(fallbackTracks.size(), [&](size_t ir, unsigned int worker) {
+      fallbackStats[worker].add(
+          fitAndStore(fallbackFitter, fallbackTracks[ir], worker, true));
+    });
   }
   auto end_fit = std::chrono::high_resolution_clock::now();
-  elapsed_seconds = end_fit - start_fit;
+  // The time of the first fits, without the refits
+  std::chrono::duration<double> elapsed_seconds = start_fallback - start_fit;
+  std::chrono::duration<double> fallback_seconds = end_fit - start_fallback;
+
+  unsigned int nFailed = std::count(fitStatus.get(), fitStatus.get() + nTracks,
+                                    false);
 
   // Log the timing measurement in ms
   std::cout << "INFO: Time (ms) to run KF track fitting for " << nTracks
-            << " with " << threads
-            << " OMP threads: " << elapsed_seconds.count() * 1000 << std::endl;
+            << " with " << threads << " (of " << pool.nWorkers()
+            << " requested) threads: " << elapsed_seconds.count() * 1000
+            << (fallback ? " (without the refits)" : "") << std::endl;
+  std::cout << "INFO: " << nFailed << " of " << nTracks << " fits failed"
+            << std::endl;
+  if (fallback) {
+    std::cout << "INFO: " << fallbackTracks.size()
+              << " tracks refitted in double precision, "
+              << fallbackTracks.size() - nFailed << " recovered, time (ms): "
+              << fallback_seconds.count() * 1000 << std::endl;
+  }
+  for (unsigned int iw = 0; iw < pool.nWorkers(); ++iw) {
+    const auto &stats = workerStats[iw];
+    std::cout << "INFO: thread " << iw << ": " << stats.nItems << " tracks in "
+              << stats.nChunks << " chunks, " << stats.nSteals
+              << " steals, busy (ms): " << stats.busyMs << std::endl;
+  }
+
+  // Aggregate the propagation counters over the batch, separately for the
+  // refits
+  auto printStats = [](const std::string &name,
+                       const std::vector<Acts::PropagatorBatchStatistics>
+                           &threadsStats) {
+    Acts::PropagatorBatchStatistics batch;
+    for (const auto &threadStats : threadsStats) {
+      batch.merge(threadStats);
+    }
+    if (batch.tracks == 0) {
+      return;
+    }
+    const auto &total = batch.total;
+    std::cout << "INFO: propagation per " << name << " (mean/max): steps "
+              << double(total.steps()) / batch.tracks << "/"
+              << batch.max.steps << ", RK trials "
+              << double(total.stepTrials) / batch.tracks << "/"
+              << batch.max.stepTrials << ", rejected steps "
+              << double(total.rejectedSteps) / batch.tracks << "/"
+              << batch.max.rejectedSteps << ", B-field evaluations "
+              << double(total.fieldEvaluations) / batch.tracks << "/"
+              << batch.max.fieldEvaluations << ", covariance transports "
+              << double(total.covarianceTransports) / batch.tracks << "/"
+              << batch.max.covarianceTransports << std::endl;
+    std::cout << "INFO: mean steps per surface:";
+    for (unsigned int is = 0; is < Acts::s_surfacesSize; ++is) {
+      std::cout << " " << double(total.surfaceSteps[is]) / batch.tracks;
+    }
+    std::cout << std::endl;
+  };
+  printStats("track", batchStats);
+  printStats("refitted track", fallbackStats);
 
   // Persistify the timing measurement in ms
   std::string precision = doublePrecision ? "timing_double" : "timing";
@@ -226,9 +308,29 @@ int main(int argc, char *argv[]) {
                                   std::to_string(nTracks), "OMP_NumThreads",
                                   std::to_string(threads)),
       elapsed_seconds.count() * 1000);
-  
-  // std::cout << fittedStates.data() << std::endl;
-  // std::cout << fittedParams.data() << std::endl;
+
+#ifdef ACTS_CPU_PROFILING
+  std::string profileName =
+      "profile_" + machine + "_nTracks_" + std::to_string(nTracks);
+  std::cout << "INFO: Writing profile summary to " << profileName << ".csv"
+            << std::endl;
+  std::ofstream profileCsv(profileName + ".csv");
+  Acts::detail::Profiler::writeSummaryCsv(profileCsv);
+  if (chromeTrace) {
+    std::cout << "INFO: Writing Chrome trace to " << profileName << ".json"
+              << std::endl;
+    std::ofstream profileJson(profileName + ".json");
+    Acts::detail::Profiler::writeChromeTrace(profileJson);
+  }
+#endif
+
+  if (TraceType::enabled) {
+    std::string traceFileName = "fit_trace_" + machine + "_nTracks_" +
+                                std::to_string(nTracks) + ".csv";
+    std::cout << "INFO: Writing KF trace to " << traceFileName << std::endl;
+    std::ofstream traceFile(traceFileName);
+    TraceType::dump(traceFile);
+  }
 
   if (output) {
     std::cout << "INFO: Writing KF track fitting results" << std::endl;
@@ -236,14 +338,20 @@ int main(int argc, char *argv[]) {
     // Write fitted states to obj file
     std::string stateFileName = "fitted_" + state + "_" + machine +
                                 "_nTracks_" + std::to_string(nTracks) + ".obj";
-    writeStatesObj(fittedStates.data(), fitStatus, nTracks, nSurfaces,
-                   stateFileName, state);
+    writeStatesObj(fittedStates.data(), fitStatus.get(), nTracks, nSurfaces,
+                   data.surfaces, stateFileName, state);
     if (smoothing) {
       // Write fitted params to cvs file
       std::string csvFileName = "fitted_param_" + machine + "_nTracks_" +
                                 std::to_string(nTracks) + ".csv";
-      writeParamsCsv(fittedParams.data(), fitStatus, nTracks, csvFileName);
+      writeParamsCsv(fittedParams.data(), fitStatus.get(), nTracks,
+                     csvFileName);
     }
+    // Write the propagation counters to csv file
+    std::string statsFileName = "propagation_stats_" + machine + "_nTracks_" +
+                                std::to_string(nTracks) + ".csv";
+    writePropagationStatsCsv(propStats.data(), fitStatus.get(), nTracks,
+                             statsFileName);
   }
 
   std::cout << "------------------------  ending  -----------------------"
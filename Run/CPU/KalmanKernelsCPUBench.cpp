@@ -0,0 +1,604 @@
+#include "Dataset.hpp"
+#include "FitData.hpp"
+
+#include "EventData/MeasurementSourceLink.hpp"
+#include "MagneticField/BFieldMapUtils.hpp"
+#include "MagneticField/InterpolatedBFieldMap.hpp"
+#include "MagneticField/SolenoidBField.hpp"
+#include "Propagator/EmbeddedRungeKuttaStepper.hpp"
+#include "Surfaces/BoundaryCheck.hpp"
+#include "Utilities/SymmetricSolver.hpp"
+// @note Utilities/Math.hpp must come after the field map headers, as its MAX
+// macro clashes with the grid helper
+#include "Utilities/Math.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Microbenchmarks of the building blocks of the Kalman fit with fixed random
+// inputs. The FLOP counts per call are estimates from the operation counts of
+// the kernels (a multiply-add counts as two), dominated by the matrix
+// products.
+
+using InterpolatedMapper3D = Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3D, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>;
+using InterpolatedBField = Acts::InterpolatedBFieldMap<InterpolatedMapper3D>;
+using InterpolatedStepper = Acts::EigenStepper<InterpolatedBField>;
+using ConstEigenStepper = Acts::EigenStepper<Test::ConstantBField>;
+using EmbeddedStepper = Acts::EmbeddedRungeKuttaStepper<Test::ConstantBField>;
+using BenchOptionsType =
+    Acts::PropagatorOptions<Test::VoidActor, Test::VoidAborter>;
+
+// The number of prepared random inputs per kernel (power of 2)
+constexpr size_t s_nInputs = 1024;
+
+static void show_usage(std::string name) {
+  std::cerr << "Usage: <option(s)> VALUES"
+            << "Options:\n"
+            << "\t-h,--help\t\tShow this help message\n"
+            << "\t-n,--calls \tSpecify the number of calls per kernel\n"
+            << "\t-k,--kernel \tRun only the kernels containing this name\n"
+            << std::endl;
+}
+
+// Prevent the compiler from optimizing away the result of a kernel
+template <typename T> inline void doNotOptimize(const T &value) {
+  asm volatile("" : : "m"(value) : "memory");
+}
+
+struct KernelResult {
+  std::string name;
+  double nsPerCall = 0;
+  double flopsPerCall = 0;
+};
+
+// Time a kernel called with the input index, the best of 5 repetitions is
+// taken to suppress the noise from other processes
+template <typename kernel_t>
+KernelResult measure(const std::string &name, double flopsPerCall,
+                     size_t nCalls, kernel_t &&kernel) {
+  for (size_t i = 0; i < nCalls / 10 + 1; ++i) {
+    kernel(i & (s_nInputs - 1));
+  }
+  double best = std::numeric_limits<double>::max();
+  for (unsigned int rep = 0; rep < 5; ++rep) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < nCalls; ++i) {
+      kernel(i & (s_nInputs - 1));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::nano>(end - start).count());
+  }
+  return KernelResult{name, best / nCalls, flopsPerCall};
+}
+
+// The largest deviation of the update with the index projection of a source
+// link from the update with its dense projection matrix H, i.e. a wrong index
+// map of the residual, the covariance products or the gain fails the
+// comparison. The deviations are relative to the largest element of the
+// compared quantities, or of the predicted parameters and covariance for the
+// filtered ones, whose rounding is that of the predicted ones.
+template <typename track_state_t>
+double indexProjectionDeviation(const Acts::GeometryContext &gctx,
+                                track_state_t trackState,
+                                const Acts::Surface *surface) {
+  using IndexProjector =
+      typename track_state_t::SourceLink::projector_indices_t;
+  // Parameters of zero, whose residual are the measured values
+  struct ZeroParameters {
+    Acts::BoundVector parameters() const { return Acts::BoundVector::Zero(); }
+  };
+  const auto &sl = trackState.measurement.uncalibrated;
+  const auto &predicted = trackState.parameter.predicted;
+  const Acts::BoundSymMatrix C = *predicted.covariance();
+  const Acts::BoundVector x = predicted.parameters();
+  const auto H = sl.projector();
+
+  // The dense update
+  const auto residual = (sl.residual(ZeroParameters()) - H * x).eval();
+  const auto CHt = (C * H.transpose()).eval();
+  const auto HCHt = (H * CHt).eval();
+  const auto K = (CHt * (HCHt + sl.covariance()).inverse()).eval();
+  const Acts::BoundSymMatrix filteredCov =
+      (Acts::BoundSymMatrix::Identity() - K * H) * C;
+
+  // The index projection and the updater using it
+  const auto indexCHt = IndexProjector::projectColumns(C);
+  const auto indexHCHt = IndexProjector::projectRows(indexCHt);
+  const auto indexK =
+      (indexCHt * (indexHCHt + sl.covariance()).inverse()).eval();
+  Acts::GainMatrixUpdater<> updater;
+  updater(gctx, trackState, surface);
+  const auto &filtered = trackState.parameter.filtered;
+
+  auto deviation = [](const auto &value, const auto &reference,
+                      ActsScalar scale) {
+    return double((value - reference).cwiseAbs().maxCoeff() / scale);
+  };
+  auto scale = [](const auto &reference) {
+    return reference.cwiseAbs().maxCoeff();
+  };
+  return std::max(
+      {deviation(sl.residual(predicted), residual, scale(residual)),
+       deviation(indexCHt, CHt, scale(CHt)),
+       deviation(indexHCHt, HCHt, scale(HCHt)),
+       deviation(indexK, K, scale(K)),
+       deviation(filtered.parameters(), x + K * residual, scale(x)),
+       deviation(*filtered.covariance(), filteredCov, scale(C))});
+}
+
+int main(int argc, char *argv[]) {
+  size_t nCalls = 200000;
+  std::string filter;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if ((arg == "-h") or (arg == "--help")) {
+      show_usage(argv[0]);
+      return 0;
+    } else if (i + 1 < argc) {
+      if ((arg == "-n") or (arg == "--calls")) {
+        nCalls = atol(argv[++i]);
+      } else if ((arg == "-k") or (arg == "--kernel")) {
+        filter = argv[++i];
+      } else {
+        std::cerr << "Unknown argument." << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  bool doublePrecision = std::is_same<ActsScalar, double>::value;
+  std::cout << "INFO: " << (doublePrecision ? "double" : "float")
+            << " precision operand used." << std::endl;
+
+  // Create a random number service
+  ActsExamples::RandomNumbers::Config config;
+  auto randomNumbers = std::make_shared<ActsExamples::RandomNumbers>(config);
+  auto rng = randomNumbers->spawnGenerator(0);
+  std::uniform_real_distribution<ActsScalar> uniform(-1., 1.);
+
+  // Create a test context
+  Acts::GeometryContext gctx;
+  Acts::MagneticFieldContext mctx;
+
+  // A small dataset and one fitted track provide realistic track states
+  FitDataset data;
+  buildDataset(gctx, mctx, rng, 16, data);
+  const size_t nSurfaces = data.nSurfaces;
+  KalmanFitterType kFitter(FitPropagatorType{Stepper()});
+  std::vector<TSType> fittedStates(nSurfaces);
+  KalmanFitterResultType kfResult;
+  if (not fitTrack(kFitter, gctx, mctx, data, 0, true, fittedStates.data(),
+                   kfResult)) {
+    std::cout << "ERROR: The fit of the reference track failed." << std::endl;
+    return 1;
+  }
+
+  // The field map of a solenoid sampled on a xyz grid
+  // @note A few coils are sufficient for the timing, the field of each point
+  // is a sum over the coils
+  Acts::SolenoidBField::Config solenoidConfig{
+      1200. * Acts::units::_mm, 6000. * Acts::units::_mm, 20,
+      2. * Acts::units::_T};
+  Acts::SolenoidBField solenoid(solenoidConfig);
+  const std::array<size_t, 3> nBins = {25, 25, 61};
+  const std::array<ActsScalar, 3> halfLengths = {600., 600., 3000.};
+  std::vector<ActsScalar> xyzPos[3];
+  for (unsigned int j = 0; j < 3; ++j) {
+    for (size_t k = 0; k < nBins[j]; ++k) {
+      xyzPos[j].push_back(-halfLengths[j] +
+                          2. * halfLengths[j] * k / (nBins[j] - 1));
+    }
+  }
+  std::vector<Acts::Vector3D> bField;
+  for (ActsScalar x : xyzPos[0]) {
+    for (ActsScalar y : xyzPos[1]) {
+      for (ActsScalar z : xyzPos[2]) {
+        bField.push_back(solenoid.getField(Acts::Vector3D(x, y, z)) /
+                         Acts::units::_T);
+      }
+    }
+  }
+  InterpolatedBField::Config fieldConfig(Acts::fieldMapperXYZ(
+      [](std::array<size_t, 3> binsXYZ, std::array<size_t, 3> nBinsXYZ) {
+        return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+                binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+      },
+      xyzPos[0], xyzPos[1], xyzPos[2], bField));
+  InterpolatedBField interpolatedField(std::move(fieldConfig));
+
+  // The random inputs
+  std::vector<Acts::Vector3D> positions(s_nInputs);
+  std::vector<Acts::Vector3D> directions(s_nInputs);
+  std::vector<Acts::Vector2D> points(s_nInputs);
+  for (size_t i = 0; i < s_nInputs; ++i) {
+    positions[i] = Acts::Vector3D(500. * uniform(rng), 500. * uniform(rng),
+                                  2000. * uniform(rng));
+    directions[i] =
+        Acts::Vector3D(1., 0.2 * uniform(rng), 0.2 * uniform(rng)).normalized();
+    points[i] = Acts::Vector2D(20. * uniform(rng), 20. * uniform(rng));
+  }
+
+  // The propagation states at the start of the reference track
+  const auto &start = data.startPars[0];
+  BenchOptionsType options(gctx, mctx);
+  ConstEigenStepper constStepper;
+  InterpolatedStepper interpolatedStepper(interpolatedField);
+  using ConstState =
+      Acts::Propagator<ConstEigenStepper>::template State<BenchOptionsType>;
+  using InterpolatedState =
+      Acts::Propagator<InterpolatedStepper>::template State<BenchOptionsType>;
+  ConstState constState(start, options);
+  InterpolatedState interpolatedState(start, options);
+  const auto constStepping = constState.stepping;
+  const auto interpolatedStepping = interpolatedState.stepping;
+  EmbeddedStepper embeddedStepper;
+  using EmbeddedState =
+      Acts::Propagator<EmbeddedStepper>::template State<BenchOptionsType>;
+  EmbeddedState embeddedState(start, options);
+  const auto embeddedStepping = embeddedState.stepping;
+  Acts::HelixStepper<Test::ConstantBField> helixStepper;
+  ConstState helixState(start, options);
+
+  // Reset the stepping state which is changed by a step
+  auto resetStepping = [](auto &stepping, const auto &initial) {
+    stepping.pos = initial.pos;
+    stepping.dir = initial.dir;
+    stepping.stepSize = Acts::ConstrainedStep(10. * Acts::units::_mm);
+    stepping.jacTransport = initial.jacTransport;
+  };
+
+  // A step data of the reference step
+  Acts::detail::StepData sd;
+  sd.B_first = constStepper.getField(constState.stepping, constStepping.pos);
+  sd.k1 = Acts::detail::evaluatek(constState, sd.B_first, 0);
+  sd.B_middle = sd.B_first;
+  sd.B_last = sd.B_first;
+  sd.k2 = Acts::detail::evaluatek(constState, sd.B_middle, 1, 5., sd.k1);
+  sd.k3 = Acts::detail::evaluatek(constState, sd.B_middle, 2, 5., sd.k2);
+  sd.k4 = Acts::detail::evaluatek(constState, sd.B_last, 3, 10., sd.k3);
+
+  // The track state on the middle surface
+  const size_t iMid = nSurfaces / 2;
+  const auto midSurface =
+      &data.surfaces[Acts::SurfaceHandle{static_cast<uint32_t>(iMid)}];
+  // The same surface without the frame cache
+  const PlaneSurfaceType uncachedSurface(midSurface->center(gctx),
+                                         Acts::Vector3D(1, 0, 0));
+  TSType updaterState = fittedStates[iMid];
+  Acts::GainMatrixUpdater<> updater;
+  Acts::GainMatrixUpdater<Acts::MixedPrecision> mixedUpdater;
+  Smoother smoother;
+  MixedSmoother mixedSmoother;
+  std::vector<TSType> smootherStates = fittedStates;
+  auto smootherContainer = Acts::CudaKernelContainer<TSType>(
+      smootherStates.data(), smootherStates.size());
+  // The batched kernels run on copies of the same track in all lanes
+  BatchedSmoother batchedSmoother;
+  std::vector<TSType> batchedSmootherStates;
+  std::vector<Acts::CudaKernelContainer<TSType>> batchedContainers;
+  for (int l = 0; l < s_batchSize; ++l) {
+    batchedSmootherStates.insert(batchedSmootherStates.end(),
+                                 fittedStates.begin(), fittedStates.end());
+  }
+  for (int l = 0; l < s_batchSize; ++l) {
+    batchedContainers.emplace_back(batchedSmootherStates.data() + l * nSurfaces,
+                                   nSurfaces);
+  }
+  std::vector<Acts::CudaKernelContainer<TSType> *> batchedContainerPtrs;
+  for (auto &container : batchedContainers) {
+    batchedContainerPtrs.push_back(&container);
+  }
+  const std::string batchedName =
+      " (" + std::to_string(s_batchSize) + " tracks)";
+  // The same track state with a strip and a pixel with time measurement
+  const auto &pixel = data.sourcelinks[iMid];
+  Acts::TrackState<Acts::StripSourceLink, TSType::Parameters> stripState(
+      Acts::StripSourceLink(pixel.localPosition().head<1>(),
+                            pixel.covariance().topLeftCorner<1, 1>(),
+                            pixel.geometryId()));
+  stripState.parameter.predicted = updaterState.parameter.predicted;
+  Acts::PixelTimeSourceLink::meas_par_t pixelTimeValues;
+  pixelTimeValues << pixel.localPosition(),
+      updaterState.parameter.predicted.parameters()(Acts::eT);
+  Acts::PixelTimeSourceLink::meas_cov_t pixelTimeCov =
+      Acts::PixelTimeSourceLink::meas_cov_t::Zero();
+  pixelTimeCov.topLeftCorner<2, 2>() = pixel.covariance();
+  pixelTimeCov(2, 2) = 1.;
+  Acts::TrackState<Acts::PixelTimeSourceLink, TSType::Parameters>
+      pixelTimeState(Acts::PixelTimeSourceLink(pixelTimeValues, pixelTimeCov,
+                                               pixel.geometryId()));
+  pixelTimeState.parameter.predicted = updaterState.parameter.predicted;
+
+  // The index projections of the source links must agree with their dense
+  // projection matrices up to the rounding of the products
+  const double projectionTolerance =
+      1e3 * std::numeric_limits<ActsScalar>::epsilon();
+  const std::pair<std::string, double> projectionDeviations[] = {
+      {"pixel", indexProjectionDeviation(gctx, updaterState, midSurface)},
+      {"strip", indexProjectionDeviation(gctx, stripState, midSurface)},
+      {"pixel with time",
+       indexProjectionDeviation(gctx, pixelTimeState, midSurface)}};
+  for (const auto &projection : projectionDeviations) {
+    std::cout << "INFO: index projection deviation (" << projection.first
+              << ") " << projection.second << " (tolerance "
+              << projectionTolerance << ")" << std::endl;
+    if (not(projection.second < projectionTolerance)) {
+      std::cout << "ERROR: The index and dense projections of the "
+                << projection.first << " measurement disagree." << std::endl;
+      return 1;
+    }
+  }
+
+  // The covariance transport inputs
+  Acts::FreeVector freeParams;
+  freeParams << constStepping.pos, constStepping.t, constStepping.dir,
+      constStepping.q / constStepping.p;
+  Acts::BoundToFreeMatrix jacToGlobal = constStepping.jacToGlobal;
+  Acts::FreeVector derivative = Acts::FreeVector::Zero();
+  derivative.head<3>() = constStepping.dir;
+  derivative.segment<3>(4) = sd.k4;
+  Acts::FreeMatrix jacTransport = Acts::FreeMatrix::Identity();
+  Acts::detail::transportMatrix(constState, sd, 10., jacTransport);
+  // The transport matrix of the next step
+  Acts::detail::BlockTransportMatrix blockTransport;
+  Acts::detail::transportMatrix(constState, sd, 5., blockTransport);
+  const Acts::FreeMatrix denseTransport = blockTransport.dense();
+  const Acts::BoundSymMatrix predictedCov =
+      *fittedStates[iMid].parameter.predicted.covariance();
+  const Acts::BoundMatrix jacobianCov =
+      fittedStates[iMid].parameter.jacobian *
+      (*fittedStates[iMid - 1].parameter.filtered.covariance());
+
+  // The inputs of the covariance products
+  using Projector = Acts::PixelSourceLink::projector_t;
+  using IndexProjector = Acts::PixelSourceLink::projector_indices_t;
+  using Gain = Acts::ActsMatrixD<Acts::eBoundParametersSize, 2>;
+  const Acts::BoundMatrix transportJacobian =
+      fittedStates[iMid].parameter.jacobian;
+  const Projector H = data.sourcelinks[iMid].projector();
+  const Gain K =
+      predictedCov * H.transpose() *
+      (H * predictedCov * H.transpose() + data.sourcelinks[iMid].covariance())
+          .inverse();
+
+  // The measurements of a long track in reverse order of the surfaces, i.e.
+  // the worst case for the cursor
+  const size_t nMeasurements = 100;
+  std::vector<Acts::PixelSourceLink> measurements;
+  for (size_t i = 0; i < nMeasurements; ++i) {
+    auto sl = data.sourcelinks[i % nSurfaces];
+    measurements.push_back(Acts::PixelSourceLink(
+        sl.localPosition(), sl.covariance(),
+        Acts::GeometryID().setVolume(1u).setLayer(nMeasurements - i)));
+  }
+  std::vector<unsigned int> measurementIndex(nMeasurements);
+  Acts::MeasurementContainer<Acts::PixelSourceLink>::sortIndex(
+      measurements.data(), nMeasurements, measurementIndex.data());
+  const auto measurementContainer =
+      Acts::CudaKernelContainer<Acts::PixelSourceLink>(measurements.data(),
+                                                       nMeasurements);
+  const Acts::MeasurementContainer<Acts::PixelSourceLink> unindexed(
+      measurementContainer);
+  const Acts::MeasurementContainer<Acts::PixelSourceLink> indexed(
+      measurementContainer, measurementIndex.data());
+
+  Acts::BoundaryCheck bcheck(true);
+  const Acts::Vector2D lowerLeft(-10., -10.);
+  const Acts::Vector2D upperRight(10., 10.);
+
+  std::vector<KernelResult> results;
+  auto run = [&](const std::string &name, double flops, auto &&kernel) {
+    if (filter.empty() or name.find(filter) != std::string::npos) {
+      results.push_back(measure(name, flops, nCalls, kernel));
+    }
+  };
+
+  run("EigenStepper::step (constant field)", 770., [&](size_t) {
+    resetStepping(constState.stepping, constStepping);
+    bool res = constStepper.step(constState);
+    doNotOptimize(res);
+    doNotOptimize(constState.stepping.pos);
+  });
+  run("EigenStepper::step (interpolated field)", 920., [&](size_t) {
+    resetStepping(interpolatedState.stepping, interpolatedStepping);
+    bool res = interpolatedStepper.step(interpolatedState);
+    doNotOptimize(res);
+    doNotOptimize(interpolatedState.stepping.pos);
+  });
+  run("HelixStepper::step", 330., [&](size_t) {
+    resetStepping(helixState.stepping, constStepping);
+    bool res = helixStepper.step(helixState);
+    doNotOptimize(res);
+    doNotOptimize(helixState.stepping.pos);
+  });
+  run("EmbeddedRungeKuttaStepper::step", 2000., [&](size_t) {
+    resetStepping(embeddedState.stepping, embeddedStepping);
+    bool res = embeddedStepper.step(embeddedState);
+    doNotOptimize(res);
+    doNotOptimize(embeddedState.stepping.pos);
+  });
+  run("detail::transportMatrix", 370., [&](size_t) {
+    Acts::detail::BlockTransportMatrix D;
+    Acts::detail::transportMatrix(constState, sd, 10., D);
+    doNotOptimize(D);
+  });
+  run("D * J (dense)", 1024., [&](size_t) {
+    Acts::FreeMatrix jac = denseTransport * jacTransport;
+    doNotOptimize(jac);
+  });
+  run("BlockTransportMatrix::accumulate", 256., [&](size_t) {
+    Acts::FreeMatrix jac = jacTransport;
+    blockTransport.accumulate(jac);
+    doNotOptimize(jac);
+  });
+  run("detail::covarianceTransport", 1820., [&](size_t) {
+    Acts::BoundSymMatrix cov = predictedCov;
+    Acts::BoundMatrix jacobian;
+    Acts::FreeMatrix jac = jacTransport;
+    Acts::FreeVector deriv = derivative;
+    Acts::BoundToFreeMatrix toGlobal = jacToGlobal;
+    Acts::detail::covarianceTransport<PlaneSurfaceType>(
+        gctx, cov, jacobian, jac, deriv, toGlobal, freeParams, *midSurface);
+    doNotOptimize(cov);
+  });
+  run("detail::covarianceTransport (double transport)", 1820., [&](size_t) {
+    Acts::BoundSymMatrix cov = predictedCov;
+    Acts::BoundMatrix jacobian;
+    Acts::FreeMatrix jac = jacTransport;
+    Acts::FreeVector deriv = derivative;
+    Acts::BoundToFreeMatrix toGlobal = jacToGlobal;
+    Acts::detail::covarianceTransport<PlaneSurfaceType, double>(
+        gctx, cov, jacobian, jac, deriv, toGlobal, freeParams, *midSurface);
+    doNotOptimize(cov);
+  });
+  run("GainMatrixUpdater::operator()", 280., [&](size_t) {
+    bool res = updater(gctx, updaterState, midSurface);
+    doNotOptimize(res);
+    doNotOptimize(updaterState.parameter.filtered);
+  });
+  run("GainMatrixUpdater::operator() (double update)", 280., [&](size_t) {
+    bool res = mixedUpdater(gctx, updaterState, midSurface);
+    doNotOptimize(res);
+    doNotOptimize(updaterState.parameter.filtered);
+  });
+  run("GainMatrixUpdater::operator() (strip)", 130., [&](size_t) {
+    bool res = updater(gctx, stripState, midSurface);
+    doNotOptimize(res);
+    doNotOptimize(stripState.parameter.filtered);
+  });
+  run("GainMatrixUpdater::operator() (pixel with time)", 460., [&](size_t) {
+    bool res = updater(gctx, pixelTimeState, midSurface);
+    doNotOptimize(res);
+    doNotOptimize(pixelTimeState.parameter.filtered);
+  });
+  run("GainMatrixSmoother::operator()", 2300. * (nSurfaces - 1), [&](size_t) {
+    auto smoothed = smoother(gctx, smootherContainer);
+    doNotOptimize(smoothed);
+  });
+  run("GainMatrixSmoother::operator() (double update)",
+      2300. * (nSurfaces - 1), [&](size_t) {
+        auto smoothed = mixedSmoother(gctx, smootherContainer);
+        doNotOptimize(smoothed);
+      });
+  run("BatchedGainMatrixSmoother::operator()" + batchedName,
+      2300. * (nSurfaces - 1) * s_batchSize, [&](size_t) {
+        bool success[s_batchSize];
+        int nSmoothed =
+            batchedSmoother(gctx, batchedContainerPtrs.data(), success);
+        doNotOptimize(nSmoothed);
+      });
+  run("J * C * J^T (dense)", 864., [&](size_t) {
+    Acts::BoundSymMatrix cov =
+        transportJacobian * predictedCov * transportJacobian.transpose();
+    doNotOptimize(cov);
+  });
+  run("H * C * H^T (dense)", 192., [&](size_t) {
+    Acts::PixelSourceLink::meas_cov_t cov = H * predictedCov * H.transpose();
+    doNotOptimize(cov);
+  });
+  run("H * C * H^T (index)", 0., [&](size_t) {
+    Acts::PixelSourceLink::meas_cov_t cov = IndexProjector::projectRows(
+        IndexProjector::projectColumns(predictedCov));
+    doNotOptimize(cov);
+  });
+  run("C - K * H * C (dense)", 324., [&](size_t) {
+    Acts::BoundSymMatrix cov = predictedCov - K * (H * predictedCov);
+    doNotOptimize(cov);
+  });
+  run("C - K * H * C (index)", 144., [&](size_t) {
+    Acts::BoundSymMatrix cov =
+        predictedCov -
+        K * IndexProjector::projectColumns(predictedCov).transpose();
+    doNotOptimize(cov);
+  });
+  run("calculateInverse (6x6)", 450., [&](size_t) {
+    auto inverse = Acts::calculateInverse<ActsScalar>(predictedCov);
+    doNotOptimize(inverse);
+  });
+  run("calculateInverse (6x6, dynamic)", 450., [&](size_t) {
+    auto inverse = Acts::calculateInverse<ActsScalar>(
+        Acts::ActsMatrixX<ActsScalar>(predictedCov));
+    doNotOptimize(inverse);
+  });
+  run("SymmetricLDLT::solve (6x6)", 430., [&](size_t) {
+    const Acts::SymmetricLDLT<ActsScalar, Acts::eBoundParametersSize> ldlt(
+        predictedCov);
+    Acts::BoundMatrix solution = ldlt.solve(jacobianCov);
+    doNotOptimize(solution);
+  });
+  run("MeasurementContainer::find (cursor)", 0., [&](size_t i) {
+    const size_t im = i % nMeasurements;
+    auto sl = indexed.find(measurements[im].geometryId(), im);
+    doNotOptimize(sl);
+  });
+  run("MeasurementContainer::find (index, 100)", 0., [&](size_t i) {
+    auto sl = indexed.find(measurements[i % nMeasurements].geometryId());
+    doNotOptimize(sl);
+  });
+  run("MeasurementContainer::find (scan, 100)", 0., [&](size_t i) {
+    auto sl = unindexed.find(measurements[i % nMeasurements].geometryId(),
+                             nMeasurements);
+    doNotOptimize(sl);
+  });
+  run("InterpolatedBFieldMap::getField", 50., [&](size_t i) {
+    Acts::Vector3D field = interpolatedField.getField(positions[i]);
+    doNotOptimize(field);
+  });
+  run("InterpolatedBFieldMap copy (shared grid)", 0., [&](size_t) {
+    InterpolatedBField field(interpolatedField);
+    doNotOptimize(field);
+  });
+  run("PlaneSurface::intersect", 20., [&](size_t i) {
+    auto intersection = midSurface->intersect(gctx, positions[i],
+                                              directions[i], bcheck);
+    doNotOptimize(intersection);
+  });
+  run("PlaneSurface::globalToLocal (frame cache)", 15., [&](size_t i) {
+    Acts::Vector2D local;
+    bool onSurface = midSurface->globalToLocal(gctx, positions[i],
+                                               directions[i], local);
+    doNotOptimize(onSurface);
+    doNotOptimize(local);
+  });
+  run("PlaneSurface::globalToLocal (no cache)", 80., [&](size_t i) {
+    Acts::Vector2D local;
+    bool onSurface = uncachedSurface.globalToLocal(gctx, positions[i],
+                                                   directions[i], local);
+    doNotOptimize(onSurface);
+    doNotOptimize(local);
+  });
+  run("BoundaryCheck::isInside", 4., [&](size_t i) {
+    bool inside = bcheck.isInside(points[i], lowerLeft, upperRight);
+    doNotOptimize(inside);
+  });
+
+  std::cout << std::left << std::setw(42) << "kernel" << std::right
+            << std::setw(12) << "ns/call" << std::setw(14) << "FLOP/call"
+            << std::setw(12) << "GFLOP/s" << std::endl;
+  for (const auto &result : results) {
+    std::cout << std::left << std::setw(42) << result.name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(1)
+              << result.nsPerCall << std::setw(14) << std::setprecision(0)
+              << result.flopsPerCall << std::setw(12) << std::setprecision(2);
+    // No FLOP rate for the kernels without floating point work
+    if (result.flopsPerCall > 0) {
+      std::cout << result.flopsPerCall / result.nsPerCall << std::endl;
+    } else {
+      std::cout << "-" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,390 @@
+#include "Dataset.hpp"
+#include "FitData.hpp"
+
+#include "MagneticField/BFieldMapUtils.hpp"
+#include "MagneticField/InterpolatedBFieldMap.hpp"
+#include "MagneticField/SolenoidBField.hpp"
+#include "Propagator/EmbeddedRungeKuttaStepper.hpp"
+#include "Propagator/HelixStepper.hpp"
+// @note Utilities/Math.hpp must come after the field map headers, as its MAX
+// macro clashes with the grid helper
+#include "Utilities/Math.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Comparison of the RK4 EigenStepper, the embedded Runge-Kutta steppers and
+// the HelixStepper: the time, the steps, the rejected trials and the field
+// evaluations of the track fit and of the free propagation over a fixed path,
+// and the accuracy of the free propagation w.r.t. the exact helix in a
+// constant field.
+
+using InterpolatedMapper3D = Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3D, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>;
+using InterpolatedBField = Acts::InterpolatedBFieldMap<InterpolatedMapper3D>;
+using BenchOptionsType =
+    Acts::PropagatorOptions<Test::VoidActor, Test::VoidAborter>;
+
+using RK4Stepper = Acts::EigenStepper<Test::ConstantBField>;
+using ConstHelixStepper = Acts::HelixStepper<Test::ConstantBField>;
+template <typename bfield_t>
+using BS32Stepper =
+    Acts::EmbeddedRungeKuttaStepper<bfield_t, Acts::detail::BogackiShampine32>;
+template <typename bfield_t>
+using DP54Stepper =
+    Acts::EmbeddedRungeKuttaStepper<bfield_t, Acts::detail::DormandPrince54>;
+
+// The fitter with a stepper in the constant field
+template <typename stepper_t>
+using BenchPropagatorType =
+    Acts::Propagator<stepper_t, Acts::DirectNavigator<PlaneSurfaceType>,
+                     TraceType>;
+template <typename stepper_t>
+using BenchKalmanFitterType =
+    Acts::KalmanFitter<BenchPropagatorType<stepper_t>,
+                       Acts::GainMatrixUpdater<>, Smoother>;
+
+static void show_usage(std::string name) {
+  std::cerr << "Usage: <option(s)> VALUES"
+            << "Options:\n"
+            << "\t-h,--help\t\tShow this help message\n"
+            << "\t-t,--tracks \tSpecify the number of tracks\n"
+            << "\t-l,--length \tSpecify the path length (mm) of the free "
+               "propagation\n"
+            << "\t-e,--tolerance \tSpecify the stepping tolerance\n"
+            << std::endl;
+}
+
+// The counters and timing of a stepper over all tracks
+struct StepperSummary {
+  std::string name;
+  double msTotal = 0;
+  size_t nFailed = 0;
+  double pathLength = 0;
+  Acts::PropagatorBatchStatistics batch;
+  // The largest deviation from the reference, e.g. the fitted parameters with
+  // the EigenStepper or the exact helix
+  double maxDeviation = 0;
+
+  void print(std::ostream &os) const {
+    const double tracks = std::max(batch.tracks, 1u);
+    const auto &total = batch.total;
+    os << std::left << std::setw(28) << name << std::right << std::fixed
+       << std::setprecision(2) << std::setw(10) << msTotal * 1e6 / tracks
+       << std::setw(8) << nFailed << std::setw(9) << total.steps() / tracks
+       << std::setw(9) << total.stepTrials / tracks << std::setw(10)
+       << total.rejectedSteps / tracks << std::setw(10)
+       << total.fieldEvaluations / tracks;
+    if (pathLength > 0) {
+      os << std::setw(10) << total.fieldEvaluations * 1000. / pathLength
+         << std::setw(10) << total.rejectedSteps * 1000. / pathLength;
+    } else {
+      os << std::setw(10) << "-" << std::setw(10) << "-";
+    }
+    os << std::scientific << std::setprecision(2) << std::setw(11)
+       << maxDeviation << std::endl;
+  }
+};
+
+static void printHeader(std::ostream &os, const std::string &title) {
+  os << "INFO: " << title << std::endl;
+  os << std::left << std::setw(28) << "stepper" << std::right << std::setw(10)
+     << "ns/track" << std::setw(8) << "failed" << std::setw(9) << "steps"
+     << std::setw(9) << "trials" << std::setw(10) << "rejected"
+     << std::setw(10) << "B evals" << std::setw(10) << "B evals/m"
+     << std::setw(10) << "rej./m" << std::setw(11) << "max dev."
+     << std::endl;
+}
+
+// The position after the path length s on the helix through the start
+// position and direction in the field (0, 0, bz)
+static Acts::Vector3D helixPosition(const Acts::Vector3D &pos,
+                                    const Acts::Vector3D &dir, double qop,
+                                    double bz, double s) {
+  // dT/ds = q/p T x B rotates the transverse direction by -kappa s
+  const double kappa = qop * bz;
+  const std::complex<double> t0(dir.x(), dir.y());
+  const std::complex<double> i(0., 1.);
+  const std::complex<double> dxy =
+      std::abs(kappa * s) < 1e-12
+          ? t0 * s
+          : t0 * (std::exp(-i * kappa * s) - 1.) / (-i * kappa);
+  return Acts::Vector3D(pos.x() + dxy.real(), pos.y() + dxy.imag(),
+                        pos.z() + dir.z() * s);
+}
+
+// The largest relative deviation of the helix functions of the turning angle
+// from their closed forms in long double, evaluated on both sides of the
+// angles where they switch between the series and the closed form
+static double helixSeriesDeviation() {
+  using Helix = Acts::detail::Helix;
+  using Real = long double;
+  struct Function {
+    ActsScalar (*helix)(ActsScalar);
+    Real (*reference)(Real);
+    ActsScalar threshold;
+  };
+  const Function functions[] = {
+      {Helix::sinc, [](Real phi) { return std::sin(phi) / phi; },
+       Helix::s_smallAngle},
+      {Helix::cosc,
+       [](Real phi) { return 2 * std::pow(std::sin(phi / 2), 2) / phi; },
+       Helix::s_smallAngle},
+      {Helix::g1,
+       [](Real phi) {
+         return (std::sin(phi) - phi * std::cos(phi)) / (phi * phi);
+       },
+       Helix::s_seriesAngle},
+      {Helix::g2,
+       [](Real phi) {
+         return (phi * std::sin(phi) - 2 * std::pow(std::sin(phi / 2), 2)) /
+                (phi * phi);
+       },
+       Helix::s_seriesAngle}};
+  double maxDeviation = 0;
+  for (const auto &function : functions) {
+    for (double factor : {-1.001, -0.999, 0.999, 1.001}) {
+      const ActsScalar phi = factor * function.threshold;
+      const Real reference = function.reference(phi);
+      maxDeviation = std::max<double>(
+          maxDeviation,
+          std::abs((function.helix(phi) - reference) / reference));
+    }
+  }
+  return maxDeviation;
+}
+
+int main(int argc, char *argv[]) {
+  unsigned int nTracks = 1000;
+  ActsScalar pathLength = 2000. * Acts::units::_mm;
+  ActsScalar tolerance = 1e-4;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if ((arg == "-h") or (arg == "--help")) {
+      show_usage(argv[0]);
+      return 0;
+    } else if (i + 1 < argc) {
+      if ((arg == "-t") or (arg == "--tracks")) {
+        nTracks = atoi(argv[++i]);
+      } else if ((arg == "-l") or (arg == "--length")) {
+        pathLength = atof(argv[++i]);
+      } else if ((arg == "-e") or (arg == "--tolerance")) {
+        tolerance = atof(argv[++i]);
+      } else {
+        std::cerr << "Unknown argument." << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  bool doublePrecision = std::is_same<ActsScalar, double>::value;
+  std::cout << "INFO: " << (doublePrecision ? "double" : "float")
+            << " precision operand used." << std::endl;
+
+  // The series and the closed forms of the helix must agree up to the
+  // rounding of the closed forms near the switch-over
+  const double seriesDeviation = helixSeriesDeviation();
+  const double seriesTolerance =
+      1e4 * std::numeric_limits<ActsScalar>::epsilon();
+  std::cout << "INFO: helix series deviation at the switch-over "
+            << seriesDeviation << " (tolerance " << seriesTolerance << ")"
+            << std::endl;
+  if (not(seriesDeviation < seriesTolerance)) {
+    std::cout << "ERROR: The helix series and closed forms disagree."
+              << std::endl;
+    return 1;
+  }
+
+  // Create a random number service
+  ActsExamples::RandomNumbers::Config config;
+  auto randomNumbers = std::make_shared<ActsExamples::RandomNumbers>(config);
+  auto rng = randomNumbers->spawnGenerator(0);
+
+  // Create a test context
+  Acts::GeometryContext gctx;
+  Acts::MagneticFieldContext mctx;
+
+  // Create the geometry, run the simulation and the smearing
+  FitDataset data;
+  buildDataset(gctx, mctx, rng, nTracks, data);
+  const size_t nSurfaces = data.nSurfaces;
+
+  // The field map of a solenoid sampled on a xyz grid, which contains the
+  // free propagation of the default path length
+  Acts::SolenoidBField::Config solenoidConfig{
+      1200. * Acts::units::_mm, 6000. * Acts::units::_mm, 20,
+      2. * Acts::units::_T};
+  Acts::SolenoidBField solenoid(solenoidConfig);
+  const std::array<size_t, 3> nBins = {81, 81, 61};
+  const std::array<ActsScalar, 3> halfLengths = {2000., 2000., 3000.};
+  std::vector<ActsScalar> xyzPos[3];
+  for (unsigned int j = 0; j < 3; ++j) {
+    for (size_t k = 0; k < nBins[j]; ++k) {
+      xyzPos[j].push_back(-halfLengths[j] +
+                          2. * halfLengths[j] * k / (nBins[j] - 1));
+    }
+  }
+  std::vector<Acts::Vector3D> bField;
+  for (ActsScalar x : xyzPos[0]) {
+    for (ActsScalar y : xyzPos[1]) {
+      for (ActsScalar z : xyzPos[2]) {
+        bField.push_back(solenoid.getField(Acts::Vector3D(x, y, z)) /
+                         Acts::units::_T);
+      }
+    }
+  }
+  InterpolatedBField::Config fieldConfig(Acts::fieldMapperXYZ(
+      [](std::array<size_t, 3> binsXYZ, std::array<size_t, 3> nBinsXYZ) {
+        return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+                binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+      },
+      xyzPos[0], xyzPos[1], xyzPos[2], bField));
+  InterpolatedBField interpolatedField(std::move(fieldConfig));
+
+  // The track fit of all tracks with a stepper, compared with the fitted
+  // parameters of the first (reference) stepper
+  std::vector<Acts::BoundParameters<Acts::LineSurface>> referenceParams;
+  std::vector<bool> referenceStatus;
+  std::vector<TSType> fittedStates(nSurfaces);
+  auto fitAll = [&](const std::string &name, const auto &kFitter) {
+    StepperSummary summary;
+    summary.name = name;
+    const bool reference = referenceParams.empty();
+    // Warmup
+    for (size_t it = 0; it < std::min<size_t>(nTracks, 100); ++it) {
+      KalmanFitterResultType kfResult;
+      fitTrack(kFitter, gctx, mctx, data, it, true, fittedStates.data(),
+               kfResult);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t it = 0; it < nTracks; ++it) {
+      KalmanFitterResultType kfResult;
+      bool status = fitTrack(kFitter, gctx, mctx, data, it, true,
+                             fittedStates.data(), kfResult);
+      summary.batch.add(kfResult.statistics);
+      if (reference) {
+        referenceParams.push_back(kfResult.fittedParameters);
+        referenceStatus.push_back(status);
+      } else if (status and referenceStatus[it]) {
+        const Acts::BoundVector diff =
+            kfResult.fittedParameters.parameters() -
+            referenceParams[it].parameters();
+        summary.maxDeviation =
+            std::max<double>(summary.maxDeviation, diff.cwiseAbs().maxCoeff());
+      }
+      summary.nFailed += not status;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    summary.msTotal =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    return summary;
+  };
+
+  printHeader(std::cout, "Track fit of " + std::to_string(nTracks) +
+                             " tracks in the constant field (max dev. of the "
+                             "fitted parameters w.r.t. RK4)");
+  fitAll("EigenStepper (RK4)",
+         BenchKalmanFitterType<RK4Stepper>(
+             BenchPropagatorType<RK4Stepper>{RK4Stepper()}))
+      .print(std::cout);
+  using BS32ConstStepper = BS32Stepper<Test::ConstantBField>;
+  using DP54ConstStepper = DP54Stepper<Test::ConstantBField>;
+  fitAll("Embedded (BS32)",
+         BenchKalmanFitterType<BS32ConstStepper>(
+             BenchPropagatorType<BS32ConstStepper>{BS32ConstStepper()}))
+      .print(std::cout);
+  fitAll("Embedded (DP54)",
+         BenchKalmanFitterType<DP54ConstStepper>(
+             BenchPropagatorType<DP54ConstStepper>{DP54ConstStepper()}))
+      .print(std::cout);
+  fitAll("HelixStepper",
+         BenchKalmanFitterType<ConstHelixStepper>(
+             BenchPropagatorType<ConstHelixStepper>{ConstHelixStepper()}))
+      .print(std::cout);
+
+  // The free propagation of the start parameters over the path length, with
+  // the end positions compared with the exact helix in the constant field
+  BenchOptionsType options(gctx, mctx);
+  options.tolerance = tolerance;
+  auto propagateAll = [&](const std::string &name, const auto &stepper,
+                          bool constantField) {
+    using stepper_t = std::decay_t<decltype(stepper)>;
+    using State =
+        typename Acts::Propagator<stepper_t>::template State<BenchOptionsType>;
+    StepperSummary summary;
+    summary.name = name;
+    const double bz =
+        Test::ConstantBField::getField(Acts::Vector3D::Zero()).z();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t it = 0; it < nTracks; ++it) {
+      State state(data.startPars[it], options);
+      ActsScalar remaining = pathLength;
+      bool status = true;
+      while (status and remaining > 0.) {
+        state.stepping.stepSize.update(remaining,
+                                       Acts::ConstrainedStep::aborter, true);
+        status = stepper.step(state);
+        if (status) {
+          state.stepping.statistics.countStep(0);
+        }
+        remaining = pathLength - state.stepping.pathAccumulated;
+      }
+      summary.batch.add(state.stepping.statistics);
+      summary.pathLength += state.stepping.pathAccumulated;
+      summary.nFailed += not status;
+      if (constantField) {
+        const auto &par = data.startPars[it];
+        const Acts::Vector3D exact = helixPosition(
+            par.position(), par.momentum().normalized(),
+            par.charge() / par.momentum().norm(), bz,
+            state.stepping.pathAccumulated);
+        summary.maxDeviation = std::max<double>(
+            summary.maxDeviation, (state.stepping.pos - exact).norm());
+      }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    summary.msTotal =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    return summary;
+  };
+
+  printHeader(std::cout, "Free propagation over " +
+                             std::to_string(int(pathLength)) +
+                             " mm in the constant field (max dev. of the "
+                             "position (mm) w.r.t. the helix)");
+  propagateAll("EigenStepper (RK4)", RK4Stepper(), true).print(std::cout);
+  propagateAll("Embedded (BS32)", BS32Stepper<Test::ConstantBField>(), true)
+      .print(std::cout);
+  propagateAll("Embedded (DP54)", DP54Stepper<Test::ConstantBField>(), true)
+      .print(std::cout);
+  propagateAll("HelixStepper", ConstHelixStepper(), true).print(std::cout);
+
+  printHeader(std::cout, "Free propagation over " +
+                             std::to_string(int(pathLength)) +
+                             " mm in the interpolated solenoid field");
+  propagateAll("EigenStepper (RK4)",
+               Acts::EigenStepper<InterpolatedBField>(interpolatedField),
+               false)
+      .print(std::cout);
+  propagateAll("Embedded (BS32)",
+               BS32Stepper<InterpolatedBField>(interpolatedField), false)
+      .print(std::cout);
+  propagateAll("Embedded (DP54)",
+               DP54Stepper<InterpolatedBField>(interpolatedField), false)
+      .print(std::cout);
+
+  std::cout << "------------------------  ending  -----------------------"
+            << std::endl;
+  return 0;
+}
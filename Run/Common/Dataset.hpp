@@ -0,0 +1,228 @@
+#pragma once
+
+#include "FitData.hpp"
+#include "Processor.hpp"
+
+#include "EventData/CompactTrackState.hpp"
+#include "EventData/MeasurementContainer.hpp"
+#include "Geometry/SurfaceStore.hpp"
+#include "Material/HomogeneousSurfaceMaterial.hpp"
+
+#include "ActsExamples/MultiplicityGenerators.hpp"
+#include "ActsExamples/ParametricParticleGenerator.hpp"
+#include "ActsExamples/VertexGenerators.hpp"
+
+#include "Test/Helper.hpp"
+
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// The input of the track fitting: the telescope geometry, the simulated
+// particles and hits, the measurements and the smeared starting parameters
+// @note The containers must not be resized once built, as the starting
+// parameters refer to the target surfaces
+struct FitDataset {
+  size_t nTracks = 0;
+  size_t nSurfaces = 10;
+  Acts::SurfaceStore<PlaneSurfaceType> surfaces;
+  std::vector<ActsFatras::Particle> validParticles;
+  ActsFatras::HitBuffer simHits;
+  std::vector<Acts::LineSurface> targetSurfaces;
+  std::vector<Acts::PixelSourceLink> sourcelinks;
+  // The indices of the source links of each track sorted by geometry id
+  std::vector<unsigned int> measurementIndex;
+  ParametersContainer startPars;
+
+  const Acts::Surface *surfacePtrs() const { return surfaces.data(); }
+};
+
+// Create the telescope geometry, run the particle generation, simulation and
+// smearing for nTracks tracks
+template <typename random_engine_t>
+void buildDataset(const Acts::GeometryContext &gctx,
+                  const Acts::MagneticFieldContext &mctx, random_engine_t &rng,
+                  size_t nTracks, FitDataset &data) {
+  data.nTracks = nTracks;
+  const size_t nSurfaces = data.nSurfaces;
+
+  // Set translation vectors
+  std::vector<Acts::Vector3D> translations;
+  for (unsigned int isur = 0; isur < nSurfaces; isur++) {
+    Acts::Vector3D translation(isur * 30. + 20., 0., 0.);
+    translations.emplace_back(translation);
+  }
+  // The silicon material
+  Acts::MaterialSlab matProp(Test::makeSilicon(), 0.5 * Acts::units::_mm);
+  Acts::HomogeneousSurfaceMaterial surfaceMaterial(matProp);
+  // Create plane surfaces without boundaries
+  std::vector<PlaneSurfaceType> surfaces;
+  for (unsigned int isur = 0; isur < nSurfaces; isur++) {
+    surfaces.push_back(PlaneSurfaceType(
+        translations[isur], Acts::Vector3D(1, 0, 0), surfaceMaterial));
+  }
+
+  // Assign the geometry ID
+  for (Size isur = 0; isur < nSurfaces; isur++) {
+    auto geoID = Acts::GeometryID()
+                     .setVolume(0u)
+                     .setLayer((uint64_t)(isur))
+                     .setSensitive((uint64_t)(isur));
+    surfaces[isur].assignGeoID(geoID);
+  }
+  data.surfaces = Acts::SurfaceStore<PlaneSurfaceType>(std::move(surfaces));
+  std::cout << "INFO: Creating " << data.surfaces.size()
+            << " boundless plane surfaces" << std::endl;
+
+  // Prepare to run the particles generation
+  ActsExamples::GaussianVertexGenerator vertexGen;
+  vertexGen.stddev[Acts::eFreePos0] = 20.0 * Acts::units::_um;
+  vertexGen.stddev[Acts::eFreePos1] = 20.0 * Acts::units::_um;
+  vertexGen.stddev[Acts::eFreePos2] = 50.0 * Acts::units::_um;
+  vertexGen.stddev[Acts::eFreeTime] = 1.0 * Acts::units::_ns;
+  ActsExamples::ParametricParticleGenerator::Config pgCfg;
+  // @note We are generating 20% more particles to make sure we could get enough
+  // valid particles
+  size_t nGeneratedParticles = nTracks * 1.2;
+  ActsExamples::Generator generator = ActsExamples::Generator{
+      ActsExamples::FixedMultiplicityGenerator{nGeneratedParticles},
+      std::move(vertexGen), ActsExamples::ParametricParticleGenerator(pgCfg)};
+  // Run the generation to generate particles
+  std::vector<ActsFatras::Particle> generatedParticles;
+  runParticleGeneration(rng, generator, generatedParticles);
+
+  // Prepare to run the simulation
+  Stepper stepper;
+  PropagatorType propagator(stepper);
+  data.validParticles.resize(nTracks);
+  auto start_propagate = std::chrono::high_resolution_clock::now();
+  // Run the simulation to generate sim hits
+  // @note We will pick up the valid particles
+  runSimulation(gctx, mctx, rng, propagator, generatedParticles,
+                data.validParticles, data.simHits, data.surfacePtrs(),
+                nSurfaces);
+  auto end_propagate = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> elapsed_seconds =
+      end_propagate - start_propagate;
+  std::cout << "INFO: Time (ms) to run simulation: "
+            << elapsed_seconds.count() * 1000 << std::endl;
+
+  // Build the target surfaces based on the truth particle position
+  data.targetSurfaces.resize(nTracks);
+  buildTargetSurfaces(data.validParticles, data.targetSurfaces.data());
+
+  // The hit smearing resolution
+  std::array<ActsScalar, 2> hitResolution = {50. * Acts::units::_um,
+                                             50. * Acts::units::_um};
+  // Run sim hits smearing to create source links
+  data.sourcelinks.resize(nTracks * nSurfaces);
+  // @note pass the concreate PlaneSurfaceType pointer here
+  runHitSmearing(gctx, rng, data.simHits, hitResolution,
+                 data.sourcelinks.data(), data.surfaces.data(), nSurfaces);
+  data.measurementIndex.resize(nTracks * nSurfaces);
+  for (size_t it = 0; it < nTracks; ++it) {
+    Acts::MeasurementContainer<Acts::PixelSourceLink>::sortIndex(
+        data.sourcelinks.data() + it * nSurfaces, nSurfaces,
+        data.measurementIndex.data() + it * nSurfaces);
+  }
+
+  // The particle smearing resolution
+  ParticleSmearingParameters seedResolution;
+  // Run truth seed smearing to create starting parameters with provided
+  // reference surface
+  data.startPars =
+      runParticleSmearing(rng, gctx, data.validParticles, seedResolution,
+                          data.targetSurfaces.data(), nTracks);
+}
+
+// Fit a single track of the dataset
+// @note The fitted states are written into the nSurfaces states starting at
+// fittedStates
+template <typename kalman_fitter_t>
+inline bool fitTrack(const kalman_fitter_t &kFitter,
+                     const Acts::GeometryContext &gctx,
+                     const Acts::MagneticFieldContext &mctx,
+                     FitDataset &data, size_t it, bool smoothing,
+                     TSType *fittedStates, KalmanFitterResultType &kfResult,
+                     bool directExtrapolation = false) {
+  const size_t nSurfaces = data.nSurfaces;
+  // The fit result wrapper
+  kfResult.fittedStates =
+      Acts::CudaKernelContainer<TSType>(fittedStates, nSurfaces);
+  // The input source links wrapper
+  auto sourcelinkTrack = Acts::CudaKernelContainer<Acts::PixelSourceLink>(
+      data.sourcelinks.data() + it * nSurfaces, nSurfaces);
+  FitOptionsType kfOptions(gctx, mctx, smoothing);
+  kfOptions.referenceSurface = &data.startPars[it].referenceSurface();
+  kfOptions.directTargetExtrapolation = directExtrapolation;
+  kfOptions.measurementIndex = data.measurementIndex.data() + it * nSurfaces;
+  // Run the fit. The fittedStates will be changed here
+  return kFitter.fit(sourcelinkTrack, data.startPars[it], kfOptions, kfResult,
+                     data.surfacePtrs(), nSurfaces);
+}
+
+// Fit a group of up to batched_smoother_t::kLanes consecutive tracks: the
+// forward filter is run per track, the smoothing at once for all tracks of
+// the group and the smoothed parameters are extrapolated directly to the
+// target
+template <typename kalman_fitter_t, typename batched_smoother_t>
+inline void fitTrackGroup(const kalman_fitter_t &kFitter,
+                          const batched_smoother_t &smoother,
+                          const Acts::GeometryContext &gctx,
+                          const Acts::MagneticFieldContext &mctx,
+                          FitDataset &data, size_t firstTrack,
+                          size_t nGroupTracks, TSType *fittedStates,
+                          KalmanFitterResultType *kfResults, bool *status) {
+  constexpr int W = batched_smoother_t::kLanes;
+  assert(nGroupTracks <= size_t(W));
+  const size_t nSurfaces = data.nSurfaces;
+  // The track states of the filtered tracks, nullptr for the unused lanes
+  Acts::CudaKernelContainer<TSType> *filteredStates[W] = {};
+  for (size_t l = 0; l < nGroupTracks; ++l) {
+    status[l] = fitTrack(kFitter, gctx, mctx, data, firstTrack + l, false,
+                         fittedStates + l * nSurfaces, kfResults[l]);
+    if (status[l]) {
+      filteredStates[l] = &kfResults[l].fittedStates;
+    }
+  }
+  bool smoothed[W];
+  smoother(gctx, filteredStates, smoothed);
+  for (size_t l = 0; l < nGroupTracks; ++l) {
+    if (status[l]) {
+      FitOptionsType kfOptions(gctx, mctx, true);
+      kfOptions.referenceSurface =
+          &data.startPars[firstTrack + l].referenceSurface();
+      status[l] = smoothed[l] and
+                  kFitter.extrapolateSmoothed(kfOptions, kfResults[l]);
+    }
+  }
+}
+
+// Whether the fitted parameters of a successful fit are finite, i.e. whether
+// no NaN or infinity went through the fit unnoticed
+inline bool isFitFinite(const KalmanFitterResultType &kfResult) {
+  return kfResult.fittedParameters.parameters().allFinite() and
+         kfResult.fittedParameters.covariance()->allFinite();
+}
+
+// Store the fitted states of a track in the compact layout, with the surfaces
+// referenced by their handle and the measurements by their index in the
+// dataset
+inline void storeTrackStates(FitDataset &data, size_t it,
+                             const TSType *fittedStates,
+                             Acts::CompactTrackState *compactStates) {
+  const size_t nSurfaces = data.nSurfaces;
+  const Acts::MeasurementContainer<Acts::PixelSourceLink> measurements(
+      Acts::CudaKernelContainer<Acts::PixelSourceLink>(
+          data.sourcelinks.data() + it * nSurfaces, nSurfaces),
+      data.measurementIndex.data() + it * nSurfaces);
+  for (size_t is = 0; is < nSurfaces; ++is) {
+    const TSType &ts = fittedStates[is];
+    const auto *sl = measurements.find(ts.geometryId(), is);
+    compactStates[is] = Acts::CompactTrackState::fromTrackState(
+        ts, data.surfaces.handle(&ts.parameter.predicted.referenceSurface()),
+        sl == nullptr ? UINT32_MAX : sl - data.sourcelinks.data());
+  }
+}
@@ -2,13 +2,16 @@
 
 #include "EventData/PixelSourceLink.hpp"
 #include "EventData/TrackParameters.hpp"
+#include "Fitter/BatchedGainMatrixSmoother.hpp"
 #include "Fitter/GainMatrixSmoother.hpp"
 #include "Fitter/GainMatrixUpdater.hpp"
 #include "Fitter/KalmanFitter.hpp"
 #include "Propagator/EigenStepper.hpp"
+#include "Propagator/HelixStepper.hpp"
 #include "Propagator/Propagator.hpp"
 #include "Surfaces/LineSurface.hpp"
 #include "Surfaces/PlaneSurface.hpp"
+#include "Utilities/PackedSymMatrix.hpp"
 #include "Utilities/ParameterDefinitions.hpp"
 #include "Utilities/Units.hpp"
 
@@ -25,14 +28,54 @@
 
 using Simulator = ActsFatras::MinimalSimulator<ActsExamples::RandomEngine>;
 using PlaneSurfaceType = Acts::PlaneSurface<Acts::InfiniteBounds>;
-using Stepper = Acts::EigenStepper<Test::ConstantBField>;
+// The helix stepper, as the field advertises itself as constant
+using Stepper = Acts::DefaultStepper<Test::ConstantBField>;
 using PropagatorType = Acts::Propagator<Stepper>;
+// The trace policy of the fitting propagator, which records the steps and
+// fitted states into per-thread ring buffers if KF_TRACE is defined (host
+// only)
+#if defined(KF_TRACE) && !defined(__CUDACC__)
+using TraceType = Acts::RingBufferTrace<>;
+#else
+using TraceType = Acts::VoidTrace;
+#endif
+using FitPropagatorType =
+    Acts::Propagator<Stepper, Acts::DirectNavigator<PlaneSurfaceType>,
+                     TraceType>;
 using PropResultType = Acts::PropagatorResult;
 using PropOptionsType = Acts::PropagatorOptions<Simulator, Test::VoidAborter>;
 using Smoother =
     Acts::GainMatrixSmoother<Acts::BoundParameters<PlaneSurfaceType>>;
 using KalmanFitterType =
-    Acts::KalmanFitter<PropagatorType, Acts::GainMatrixUpdater, Smoother>;
+    Acts::KalmanFitter<FitPropagatorType, Acts::GainMatrixUpdater<>, Smoother>;
+// The fitter with the covariance update and smoothing in double precision
+using MixedSmoother =
+    Acts::GainMatrixSmoother<Acts::BoundParameters<PlaneSurfaceType>,
+                             Acts::MixedPrecision>;
+using MixedKalmanFitterType =
+    Acts::KalmanFitter<FitPropagatorType,
+                       Acts::GainMatrixUpdater<Acts::MixedPrecision>,
+                       MixedSmoother>;
+// The fitter retrying the tracks whose fit failed, with the covariance
+// transport, update and smoothing in double precision
+using FallbackStepper =
+    Acts::DefaultStepper<Test::ConstantBField, Acts::DoublePrecision>;
+using FallbackPropagatorType =
+    Acts::Propagator<FallbackStepper, Acts::DirectNavigator<PlaneSurfaceType>,
+                     TraceType>;
+using FallbackSmoother =
+    Acts::GainMatrixSmoother<Acts::BoundParameters<PlaneSurfaceType>,
+                             Acts::DoublePrecision>;
+using FallbackKalmanFitterType =
+    Acts::KalmanFitter<FallbackPropagatorType,
+                       Acts::GainMatrixUpdater<Acts::DoublePrecision>,
+                       FallbackSmoother>;
+// The number of tracks smoothed at once by the batched smoother, i.e. one
+// SIMD lane per track
+constexpr int s_batchSize = 8;
+using BatchedSmoother =
+    Acts::BatchedGainMatrixSmoother<Acts::BoundParameters<PlaneSurfaceType>,
+                                    s_batchSize>;
 using KalmanFitterResultType =
     Acts::KalmanFitterResult<Acts::PixelSourceLink,
                              Acts::BoundParameters<PlaneSurfaceType>,
@@ -42,7 +85,8 @@ using FitOptionsType = Acts::KalmanFitterOptions<Acts::VoidOutlierFinder>;
 
 using Size = unsigned int;
 
+// The start parameters copied to the device, with the packed covariance
 struct BoundState {
   Acts::BoundVector boundParams;
-  Acts::BoundMatrix boundCov;
+  Acts::BoundPackedSymMatrix boundCov;
 };
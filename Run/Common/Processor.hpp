@@ -11,7 +11,6 @@
 #include <vector>
 
 using SimParticleContainer = std::vector<ActsFatras::Particle>;
-using SimResultContainer = std::vector<Simulator::result_type>;
 using ParametersContainer =
     std::vector<Acts::BoundParameters<Acts::LineSurface>>;
 using TargetSurfaceContainer = std::vector<Acts::LineSurface>;
@@ -78,9 +77,11 @@ void runSimulation(const Acts::GeometryContext &gctx,
                    const propagator_t &propagator,
                    const SimParticleContainer &generatedParticles,
                    SimParticleContainer &validParticles,
-                   SimResultContainer &simResults,
+                   ActsFatras::HitBuffer &simHits,
                    const Acts::Surface *surfaces, size_t nSurfaces) {
   size_t ip = 0;
+  // The hits of all valid particles are appended to the buffer
+  simHits.reserve(validParticles.size(), nSurfaces);
 
   for (const auto &particle : generatedParticles) {
     if (ip < validParticles.size()) {
@@ -91,6 +92,7 @@ void runSimulation(const Acts::GeometryContext &gctx,
       propOptions.absPdgCode = particle.pdg();
       propOptions.mass = particle.mass();
       propOptions.action.generator = &rng;
+      propOptions.action.hits = &simHits;
       propOptions.action.particle = particle;
       Acts::CurvilinearParameters start(
           Acts::BoundSymMatrix::Zero(), particle.position(),
@@ -100,13 +102,14 @@ void runSimulation(const Acts::GeometryContext &gctx,
       propagator.propagate(start, propOptions, simResult);
       // The particles must have nSurfaces sim hits. Otherwise, skip this
       // simulation result
-      if (simResult.hits.size() != nSurfaces) {
+      if (simHits.nOpenHits() != nSurfaces) {
         std::cout << "Warning! Generated particle rejected!" << std::endl;
+        simHits.discard();
         continue;
       }
       // store the sim particles and hits
       validParticles[ip] = particle;
-      simResults[ip] = simResult;
+      simHits.commit();
       ip++;
     }
   }
@@ -124,6 +127,7 @@ void buildTargetSurfaces(const SimParticleContainer &validParticles,
   unsigned int ip = 0;
   for (const auto &particle : validParticles) {
     targetSurfaces[ip] = Acts::LineSurface(particle.position());
+    targetSurfaces[ip].cacheFrame();
     ip++;
   }
 }
@@ -132,15 +136,15 @@ void buildTargetSurfaces(const SimParticleContainer &validParticles,
 // Acts::Surface* to the PlaneSurfaceType* as in the DirectNavigator
 template <typename random_engine_t>
 void runHitSmearing(const Acts::GeometryContext &gctx, random_engine_t &rng,
-                    const SimResultContainer &simResults,
+                    const ActsFatras::HitBuffer &simHits,
                     const std::array<ActsScalar, 2> &resolution,
                     Acts::PixelSourceLink *sourcelinks,
                     const PlaneSurfaceType *surfaces, size_t nSurfaces) {
   // The normal dist
   std::normal_distribution<ActsScalar> stdNormal(0.0, 1.0);
   // Perform smearing to the simulated hits
-  for (int ip = 0; ip < simResults.size(); ip++) {
-    auto hits = simResults[ip].hits;
+  for (int ip = 0; ip < simHits.size(); ip++) {
+    const ActsFatras::HitSpan hits = simHits[ip];
     auto nHits = hits.size();
     if (nHits != nSurfaces) {
       throw std::invalid_argument("Sim hits size should be exactly" +
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Bookkeeping of one worker of a WorkStealingPool run, padded to avoid false
+// sharing between the workers
+struct alignas(64) WorkerStats {
+  // The number of items (e.g. tracks) processed by this worker
+  size_t nItems = 0;
+  // The number of chunks processed by this worker
+  size_t nChunks = 0;
+  // The number of successful steals from other workers
+  size_t nSteals = 0;
+  // The time (ms) spent inside the loop body
+  double busyMs = 0;
+};
+
+/// @brief A work-stealing pool which runs a loop body over the item range
+/// [0, nItems) in chunks of fixed size
+///
+/// Each worker starts with a contiguous block of chunks in its own queue and
+/// pops chunks from the front. A worker running out of chunks steals the back
+/// half of the queue of another worker, so that the load stays balanced even
+/// if the cost per item (e.g. the number of propagation steps of a track)
+/// varies a lot.
+///
+/// The worker threads are started once by the constructor and sleep between
+/// the runs, so that their thread-local buffers (e.g. of the trace and the
+/// profiler) are kept over the runs.
+///
+/// @note The calling thread participates as worker 0
+class WorkStealingPool {
+public:
+  /// Constructor, starting the nWorkers - 1 worker threads
+  ///
+  /// @param nWorkers The number of workers (including the calling thread)
+  /// @param chunkSize The number of items per chunk
+  WorkStealingPool(unsigned int nWorkers, size_t chunkSize = 16)
+      : m_nWorkers(std::max(nWorkers, 1u)),
+        m_chunkSize(std::max(chunkSize, size_t(1))),
+        m_queues(new Queue[m_nWorkers]), m_stats(m_nWorkers) {
+    m_threads.reserve(m_nWorkers - 1);
+    for (unsigned int iw = 1; iw < m_nWorkers; ++iw) {
+      m_threads.emplace_back([this, iw]() { workerLoop(iw); });
+    }
+  }
+
+  /// Destructor, stopping and joining the worker threads
+  ~WorkStealingPool() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto &thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+  /// @brief Run the loop body over all items
+  ///
+  /// @tparam body_t Type of the loop body with signature
+  /// void(size_t item, unsigned int worker)
+  ///
+  /// @param nItems The number of items
+  /// @param body The loop body
+  template <typename body_t> void run(size_t nItems, body_t &&body) {
+    const size_t nChunks = (nItems + m_chunkSize - 1) / m_chunkSize;
+    // Distribute the chunks evenly over the worker queues
+    for (unsigned int iw = 0; iw < m_nWorkers; ++iw) {
+      m_queues[iw].begin = nChunks * iw / m_nWorkers;
+      m_queues[iw].end = nChunks * (iw + 1) / m_nWorkers;
+      m_stats[iw] = WorkerStats();
+    }
+
+    auto work = [&](unsigned int iw) {
+      // Counted locally and stored once at the end of the run
+      WorkerStats stats;
+      size_t chunk = 0;
+      while (popOrSteal(iw, chunk, stats)) {
+        const size_t first = chunk * m_chunkSize;
+        const size_t last = std::min(first + m_chunkSize, nItems);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t item = first; item < last; ++item) {
+          body(item, iw);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        stats.busyMs +=
+            std::chrono::duration<double, std::milli>(end - start).count();
+        stats.nItems += last - first;
+        stats.nChunks++;
+      }
+      m_stats[iw] = stats;
+    };
+    using work_t = decltype(work);
+
+    // Wake up the workers for this run
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_work = &work;
+      m_invoke = [](void *w, unsigned int iw) {
+        (*static_cast<work_t *>(w))(iw);
+      };
+      m_nRunning = m_nWorkers - 1;
+      m_generation++;
+    }
+    m_wake.notify_all();
+    work(0);
+    // Wait for the workers to finish, as the loop body lives on this stack
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_nRunning == 0; });
+    m_work = nullptr;
+  }
+
+  /// @return The number of workers
+  unsigned int nWorkers() const { return m_nWorkers; }
+
+  /// @return The number of workers which processed at least one chunk in the
+  /// last run
+  unsigned int nActiveWorkers() const {
+    return std::count_if(m_stats.begin(), m_stats.end(),
+                         [](const WorkerStats &s) { return s.nChunks > 0; });
+  }
+
+  /// @return The per-worker statistics of the last run
+  const std::vector<WorkerStats> &stats() const { return m_stats; }
+
+private:
+  // The chunk queue of one worker, padded to avoid false sharing
+  struct alignas(64) Queue {
+    std::mutex mutex;
+    size_t begin = 0;
+    size_t end = 0;
+  };
+
+  // The loop of a worker thread, running the work of each run
+  void workerLoop(unsigned int iw) {
+    size_t generation = 0;
+    while (true) {
+      void *work = nullptr;
+      void (*invoke)(void *, unsigned int) = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock, [&]() {
+          return m_stop or m_generation != generation;
+        });
+        if (m_stop) {
+          return;
+        }
+        generation = m_generation;
+        work = m_work;
+        invoke = m_invoke;
+      }
+      invoke(work, iw);
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_nRunning--;
+      }
+      m_done.notify_one();
+    }
+  }
+
+  // Pop a chunk from the own queue or steal from the other queues
+  bool popOrSteal(unsigned int iw, size_t &chunk, WorkerStats &stats) {
+    auto &own = m_queues[iw];
+    {
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (own.begin < own.end) {
+        chunk = own.begin++;
+        return true;
+      }
+    }
+    for (unsigned int i = 1; i < m_nWorkers; ++i) {
+      auto &victim = m_queues[(iw + i) % m_nWorkers];
+      size_t first = 0, last = 0;
+      {
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.begin >= victim.end) {
+          continue;
+        }
+        // Take the back half (at least one chunk)
+        first = victim.end - (victim.end - victim.begin + 1) / 2;
+        last = victim.end;
+        victim.end = first;
+      }
+      stats.nSteals++;
+      chunk = first;
+      std::lock_guard<std::mutex> lock(own.mutex);
+      own.begin = first + 1;
+      own.end = last;
+      return true;
+    }
+    return false;
+  }
+
+  unsigned int m_nWorkers;
+  size_t m_chunkSize;
+  std::unique_ptr<Queue[]> m_queues;
+  std::vector<WorkerStats> m_stats;
+
+  // The worker threads and their synchronization with the runs
+  std::vector<std::thread> m_threads;
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  // The type-erased work of the current run
+  void *m_work = nullptr;
+  void (*m_invoke)(void *, unsigned int) = nullptr;
+  // The number of the current run, and of the workers still running it
+  size_t m_generation = 0;
+  unsigned int m_nRunning = 0;
+  bool m_stop = false;
+};
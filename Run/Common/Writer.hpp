@@ -1,13 +1,17 @@
 #pragma once
 
+#include "EventData/CompactTrackState.hpp"
 #include "EventData/TrackParameters.hpp"
 #include "EventData/detail/coordinate_transformations.hpp"
+#include "Geometry/SurfaceStore.hpp"
+#include "Propagator/PropagatorStatistics.hpp"
 #include "Utilities/Definitions.hpp"
 #include "Utilities/Helpers.hpp"
 #include "Utilities/Units.hpp"
 
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <random>
 
 template <typename hits_collection_t>
@@ -22,7 +26,7 @@ void writeSimHitsObj(const hits_collection_t &simHits, std::string fileName) {
   // Initialize the vertex counter
   unsigned int vCounter = 0;
   for (unsigned int ih = 0; ih < simHits.size(); ih++) {
-    auto hits = simHits[ih].hits;
+    const auto hits = simHits[ih];
     ++vCounter;
     for (const auto &sl : hits) {
       const auto &pos = sl.position();
@@ -74,6 +78,108 @@ void writeStatesObj(const track_state_t *states, const bool *status,
   obj_tracks.close();
 }
 
+// Write the positions of the compact track states, which are computed from
+// the bound parameters and the surfaces referenced by handle
+template <typename surface_derived_t>
+void writeStatesObj(const Acts::CompactTrackState *states, const bool *status,
+                    unsigned int nTracks, unsigned int nSurfaces,
+                    const Acts::SurfaceStore<surface_derived_t> &surfaces,
+                    std::string fileName,
+                    std::string parameters = "smoothed") {
+  // Write all of the created tracks to one obj file
+  std::ofstream obj_tracks;
+  if (fileName.empty()) {
+    fileName = "tracks-fitted.obj";
+  }
+  obj_tracks.open(fileName.c_str());
+
+  Acts::GeometryContext gctx;
+  // Initialize the vertex counter
+  unsigned int vCounter = 0;
+  for (unsigned int it = 0; it < nTracks; it++) {
+    // we skip the unsuccessful tracks
+    if (not status[it]) {
+      continue;
+    }
+    ++vCounter;
+    for (int is = 0; is < nSurfaces; is++) {
+      const auto &state = states[it * nSurfaces + is];
+      Acts::BoundVector pars;
+      if (parameters == "predicted") {
+        pars = state.predicted.parameters();
+      } else if (parameters == "filtered") {
+        pars = state.filtered.parameters();
+      } else {
+        pars = state.smoothed.parameters();
+      }
+      const Acts::Vector3D pos =
+          Acts::detail::coordinate_transformation::parameters2globalPosition<
+              surface_derived_t>(gctx, pars, surfaces[state.surface]);
+      obj_tracks << "v " << pos.x() << " " << pos.y() << " " << pos.z() << "\n";
+    }
+    // Write out the line - only if we have at least two points created
+    size_t vBreak = vCounter + nSurfaces - 1;
+    for (; vCounter < vBreak; ++vCounter)
+      obj_tracks << "l " << vCounter << " " << vCounter + 1 << '\n';
+  }
+  obj_tracks.close();
+}
+
+// Write the positions of the track states, which are computed from the bound
+// parameters and the surfaces with the geometry id of the states, i.e. without
+// access to the reference surfaces of the states (e.g. fitted on the device)
+template <typename track_state_t, typename surface_derived_t>
+void writeStatesObj(const track_state_t *states, const bool *status,
+                    unsigned int nTracks, unsigned int nSurfaces,
+                    const surface_derived_t *surfaces, std::string fileName,
+                    std::string parameters = "smoothed") {
+  // The surface index of the geometry ids
+  std::map<Acts::GeometryID::Value, unsigned int> surfaceIndex;
+  for (unsigned int is = 0; is < nSurfaces; is++) {
+    surfaceIndex[surfaces[is].geoID().value()] = is;
+  }
+
+  // Write all of the created tracks to one obj file
+  std::ofstream obj_tracks;
+  if (fileName.empty()) {
+    fileName = "tracks-fitted.obj";
+  }
+  obj_tracks.open(fileName.c_str());
+
+  Acts::GeometryContext gctx;
+  // Initialize the vertex counter
+  unsigned int vCounter = 0;
+  for (unsigned int it = 0; it < nTracks; it++) {
+    // we skip the unsuccessful tracks
+    if (not status[it]) {
+      continue;
+    }
+    ++vCounter;
+    for (int is = 0; is < nSurfaces; is++) {
+      const auto &state = states[it * nSurfaces + is];
+      Acts::BoundVector pars;
+      if (parameters == "predicted") {
+        pars = state.parameter.predicted.parameters();
+      } else if (parameters == "filtered") {
+        pars = state.parameter.filtered.parameters();
+      } else {
+        pars = state.parameter.smoothed.parameters();
+      }
+      const auto &surface =
+          surfaces[surfaceIndex.at(state.geometryId().value())];
+      const Acts::Vector3D pos =
+          Acts::detail::coordinate_transformation::parameters2globalPosition<
+              surface_derived_t>(gctx, pars, surface);
+      obj_tracks << "v " << pos.x() << " " << pos.y() << " " << pos.z() << "\n";
+    }
+    // Write out the line - only if we have at least two points created
+    size_t vBreak = vCounter + nSurfaces - 1;
+    for (; vCounter < vBreak; ++vCounter)
+      obj_tracks << "l " << vCounter << " " << vCounter + 1 << '\n';
+  }
+  obj_tracks.close();
+}
+
 template <typename parameters_t>
 void writeParamsCsv(const parameters_t *params, const bool *status,
                     unsigned int nTracks, std::string fileName) {
@@ -104,3 +210,34 @@ void writeParamsCsv(const parameters_t *params, const bool *status,
   }
   csv_params.close();
 }
+
+inline void writePropagationStatsCsv(const Acts::PropagatorStatistics *stats,
+                              const bool *status, unsigned int nTracks,
+                              std::string fileName) {
+  // Write the propagation counters of all tracks to one csv file
+  std::ofstream csv_stats;
+  if (fileName.empty()) {
+    fileName = "propagation-stats.csv";
+  }
+  csv_stats.open(fileName.c_str());
+
+  // write the csv header
+  csv_stats << "trackIdx, status, steps, stepTrials, rejectedSteps, "
+               "fieldEvaluations, covarianceTransports, surfaces";
+  for (unsigned int is = 0; is < Acts::s_surfacesSize; is++) {
+    csv_stats << ", steps_surface" << is;
+  }
+  csv_stats << '\n';
+  for (unsigned int it = 0; it < nTracks; it++) {
+    const auto &st = stats[it];
+    csv_stats << it << "," << status[it] << "," << st.steps() << ","
+              << st.stepTrials << "," << st.rejectedSteps << ","
+              << st.fieldEvaluations << "," << st.covarianceTransports << ","
+              << st.surfaces;
+    for (unsigned int is = 0; is < Acts::s_surfacesSize; is++) {
+      csv_stats << "," << st.surfaceSteps[is];
+    }
+    csv_stats << '\n';
+  }
+  csv_stats.close();
+}
@@ -264,6 +264,7 @@ int main(int argc, char *argv[]) {
     auto geoID =
         Acts::GeometryID().setVolume(0u).setLayer(isur).setSensitive(isur);
     surfaces[isur].assignGeoID(geoID);
+    surfaces[isur].cacheFrame();
   }
   const Acts::Surface *surfacePtrs = surfaces;
   std::cout << "INFO: Creating " << nSurfaces << " boundless plane surfaces"
@@ -312,10 +313,10 @@ int main(int argc, char *argv[]) {
   auto start_propagate = std::chrono::high_resolution_clock::now();
   // Run the simulation to generate sim hits
   // @note We will pick up the valid particles
-  std::vector<Simulator::result_type> simResult(nTracks);
+  ActsFatras::HitBuffer simHits;
   std::vector<ActsFatras::Particle> validParticles(nTracks);
   runSimulation(gctx, mctx, rng, propagator, generatedParticles, validParticles,
-                simResult, surfacePtrs, nSurfaces);
+                simHits, surfacePtrs, nSurfaces);
   auto end_propagate = std::chrono::high_resolution_clock::now();
   std::chrono::duration<double> elapsed_seconds =
       end_propagate - start_propagate;
@@ -327,7 +328,7 @@ int main(int argc, char *argv[]) {
         "sim_hits_for_" + std::to_string(nTracks) + "_particles.obj";
     std::cout << "INFO: Writing simulation results to " << simFileName
               << std::endl;
-    writeSimHitsObj(simResult, simFileName);
+    writeSimHitsObj(simHits, simFileName);
   }
 
   // Build the target surfaces based on the truth particle position
@@ -338,7 +339,7 @@ int main(int argc, char *argv[]) {
                                              50. * Acts::units::_um};
   // Run hit smearing to create source links
   // @note pass the concreate PlaneSurfaceType pointer here
-  runHitSmearing(gctx, rng, simResult, hitResolution, sourcelinks, surfaces,
+  runHitSmearing(gctx, rng, simHits, hitResolution, sourcelinks, surfaces,
                  nSurfaces);
 
   // The particle smearing resolution
@@ -350,7 +351,8 @@ int main(int argc, char *argv[]) {
   // Initialize the boundState
   for (Size it = 0; it < nTracks; it++) {
     boundStates[it].boundParams = startParsCollection[it].parameters();
-    boundStates[it].boundCov = *startParsCollection[it].covariance();
+    boundStates[it].boundCov =
+        Acts::BoundPackedSymMatrix(*startParsCollection[it].covariance());
   }
 
   // Prepare to perform fit to the created tracks
@@ -611,8 +613,10 @@ int main(int argc, char *argv[]) {
     // The type of the file written out
     stateFileName.append(std::to_string(nTracks)).append(".obj");
     csvFileName.append(std::to_string(nTracks)).append(".csv");
-    writeStatesObj(fitStates, fitStatus, nTracks, nSurfaces, stateFileName,
-                   state);
+    // @note The reference surfaces of the states fitted on the device are not
+    // accessible on the host
+    writeStatesObj(fitStates, fitStatus, nTracks, nSurfaces, surfaces,
+                   stateFileName, state);
     // The fitted parameters are only available after smoothing
     if (smoothing) {
       writeParamsCsv(fitPars, fitStatus, nTracks, csvFileName);
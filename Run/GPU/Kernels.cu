@@ -30,8 +30,8 @@ fitKernelThreadPerTrack(KalmanFitterType *kFitter,
         fittedStates + threadId * nSurfaces, nSurfaces);
     // Construct a start parameters (the geoContext is set to 0)
     Acts::BoundParameters<Acts::LineSurface> startPars(
-        0, startStates[threadId].boundCov, startStates[threadId].boundParams,
-        &targetSurfaces[threadId]);
+        0, startStates[threadId].boundCov.toMatrix(),
+        startStates[threadId].boundParams, &targetSurfaces[threadId]);
     // Reset the target surface
     fitOptions[threadId].referenceSurface = &targetSurfaces[threadId];
     // Perform the fit
@@ -72,8 +72,8 @@ fitKernelBlockPerTrack(KalmanFitterType *kFitter,
           fittedStates + blockId * nSurfaces, nSurfaces);
       // Construct a start parameters (the geoContext is set to 0)
       startPars = Acts::BoundParameters<Acts::LineSurface>(
-          0, startStates[blockId].boundCov, startStates[blockId].boundParams,
-          &targetSurfaces[blockId]);
+          0, startStates[blockId].boundCov.toMatrix(),
+          startStates[blockId].boundParams, &targetSurfaces[blockId]);
       // Reset the target surface
       fitOptions[blockId].referenceSurface = &targetSurfaces[blockId];
     }
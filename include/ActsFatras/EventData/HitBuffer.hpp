@@ -0,0 +1,101 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsFatras/EventData/Hit.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ActsFatras {
+
+/// @brief Non-owning view of the hits of a particle
+class HitSpan {
+public:
+  using value_type = Hit;
+  using const_iterator = const Hit *;
+
+  HitSpan() = default;
+  HitSpan(const Hit *hits, size_t size) : m_hits(hits), m_size(size) {}
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  const Hit &operator[](size_t i) const { return m_hits[i]; }
+
+  const_iterator begin() const { return m_hits; }
+  const_iterator end() const { return m_hits + m_size; }
+
+private:
+  const Hit *m_hits = nullptr;
+  size_t m_size = 0;
+};
+
+/// @brief Flat storage of the simulated hits of many particles
+///
+/// The hits of all particles are stored in one contiguous array, which is
+/// reserved once for the expected number of hits and only appended to, i.e.
+/// it is used like an arena. The hits of a particle are delimited by offsets
+/// and read as a HitSpan without copying.
+///
+/// The simulator appends the hits of the particle being simulated, i.e. the
+/// open particle, which are then either committed or discarded, e.g. if the
+/// particle is rejected.
+class HitBuffer {
+public:
+  HitBuffer() = default;
+
+  /// @brief Reserve the storage of the hits and offsets
+  ///
+  /// @param nParticles The expected number of particles
+  /// @param nHitsPerParticle The expected number of hits per particle
+  void reserve(size_t nParticles, size_t nHitsPerParticle) {
+    m_hits.reserve(nParticles * nHitsPerParticle);
+    m_offsets.reserve(nParticles + 1);
+  }
+
+  /// @return The number of committed particles
+  size_t size() const { return m_offsets.size() - 1; }
+
+  /// @return The number of hits of the committed particles
+  size_t nHits() const { return m_offsets.back(); }
+
+  /// @return The hits of a committed particle
+  HitSpan operator[](size_t ip) const {
+    return HitSpan(m_hits.data() + m_offsets[ip],
+                   m_offsets[ip + 1] - m_offsets[ip]);
+  }
+
+  /// @brief Append a hit to the open particle
+  ///
+  /// @param args The arguments of the hit constructor
+  template <typename... args_t> void emplace_back(args_t &&... args) {
+    m_hits.emplace_back(std::forward<args_t>(args)...);
+  }
+
+  /// @return The number of hits of the open particle
+  size_t nOpenHits() const { return m_hits.size() - m_offsets.back(); }
+
+  /// @brief Commit the hits of the open particle
+  void commit() { m_offsets.push_back(m_hits.size()); }
+
+  /// @brief Discard the hits of the open particle
+  void discard() {
+    m_hits.erase(m_hits.begin() + m_offsets.back(), m_hits.end());
+  }
+
+private:
+  /// The hits of all particles
+  std::vector<Hit> m_hits;
+  /// The offset of the first hit of each particle and the end offset
+  std::vector<size_t> m_offsets = {0};
+};
+
+} // namespace ActsFatras
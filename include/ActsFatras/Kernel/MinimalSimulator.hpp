@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ActsFatras/EventData/Hit.hpp"
+#include "ActsFatras/EventData/HitBuffer.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 #include "ActsFatras/Physics/EnergyLoss/BetheBloch.hpp"
 #include "ActsFatras/Physics/EnergyLoss/BetheHeitler.hpp"
@@ -27,6 +28,8 @@ namespace ActsFatras {
 template <typename generator_t> struct MinimalSimulator {
   // Random number generator used for the simulation.
   generator_t *generator = nullptr;
+  /// The buffer the hits are appended to, as hits of its open particle
+  HitBuffer *hits = nullptr;
   /// Initial particle state.
   Particle particle;
   /// Highland scattering
@@ -47,10 +50,8 @@ template <typename generator_t> struct MinimalSimulator {
     Particle::Scalar pathInL0 = 0;
     /// Whether the particle is alive or not, i.e. could be simulated further.
     bool isAlive = true;
-    /// Additional particles generated by interactions.
-    std::vector<Particle> generatedParticles;
-    /// Hits created by the particle.
-    std::vector<Hit> hits;
+    /// @note The hits are stored in the hit buffer and no secondary particles
+    /// are generated, i.e. the result does not allocate
   };
   using result_type = this_result;
 
@@ -58,6 +59,7 @@ template <typename generator_t> struct MinimalSimulator {
   void operator()(propagator_state_t &state, const stepper_t &stepper,
                   result_type &result) const {
     assert(generator and "The generator pointer must be valid");
+    assert(hits and "The hit buffer pointer must be valid");
 
     if (state.navigation.currentSurface == nullptr) {
       return;
@@ -124,11 +126,11 @@ template <typename generator_t> struct MinimalSimulator {
     }
     // store results of this interaction step, including potential hits
     result.particle = after;
-    result.hits.emplace_back(
+    hits->emplace_back(
         Acts::GeometryID(), before.particleId(),
         // the interaction could potentially modify the particle position
         Hit::Scalar(0.5) * (before.position4() + after.position4()),
-        before.momentum4(), after.momentum4(), result.hits.size());
+        before.momentum4(), after.momentum4(), hits->nOpenHits());
 
     // continue the propagation with the modified parameters
     stepper.update(state.stepping, after.position(), after.unitDirection(),
@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Geometry/GeometryContext.hpp"
+#include "Geometry/GeometryID.hpp"
+#include "Geometry/SurfaceStore.hpp"
+#include "Utilities/PackedSymMatrix.hpp"
+#include "Utilities/ParameterDefinitions.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Acts {
+
+class Surface;
+
+/// @brief Bound parameters and packed covariance
+///
+/// Unlike the bound track parameters, neither the global position and
+/// momentum nor the reference surface are stored, and only the upper triangle
+/// of the covariance is stored.
+struct CompactBoundParameters {
+  /// The bound parameters
+  BoundParametersScalar values[eBoundParametersSize];
+  /// The packed covariance
+  BoundPackedSymMatrix covariance;
+
+  /// @return The bound parameters as Eigen vector
+  ACTS_DEVICE_FUNC BoundVector parameters() const {
+    return Eigen::Map<const BoundVector>(values);
+  }
+
+  /// @return The covariance as Eigen matrix
+  ACTS_DEVICE_FUNC BoundSymMatrix covarianceMatrix() const {
+    return covariance.toMatrix();
+  }
+
+  /// @brief Set the parameters and covariance
+  ///
+  /// @param pars The bound parameters
+  /// @param cov The covariance (only the upper triangle is used)
+  ACTS_DEVICE_FUNC void set(const BoundVector &pars,
+                            const BoundSymMatrix &cov) {
+    Eigen::Map<BoundVector> parsMap(values);
+    parsMap = pars;
+    covariance = BoundPackedSymMatrix(cov);
+  }
+
+  /// @brief Recreate the bound track parameters
+  ///
+  /// @tparam parameters_t The type of the bound track parameters
+  /// @param gctx The geometry context
+  /// @param surface The reference surface of the parameters
+  template <typename parameters_t>
+  ACTS_DEVICE_FUNC parameters_t toParameters(const GeometryContext &gctx,
+                                             const Surface *surface) const {
+    return parameters_t(gctx, covarianceMatrix(), parameters(), surface);
+  }
+};
+
+/// @brief Compact representation of a TrackState for storage and I/O
+///
+/// The state is trivially copyable and has a standard layout, i.e. an array
+/// of states can be copied with memcpy, written to and mapped from a file or
+/// transferred to the device as it is. The surface is referenced by its handle
+/// in the surface store and the measurement by its index in the container of
+/// the event.
+struct CompactTrackState {
+  /// The predicted, filtered and smoothed parameters
+  CompactBoundParameters predicted;
+  CompactBoundParameters filtered;
+  CompactBoundParameters smoothed;
+  /// The transport jacobian in column-major order
+  BoundParametersScalar jacobian[eBoundParametersSize * eBoundParametersSize];
+  /// The path length along the track
+  BoundParametersScalar pathLength;
+  /// The chisquare
+  BoundParametersScalar chi2;
+  /// The surface geometry identifier
+  GeometryID::Value geometryId;
+  /// The handle of the reference surface
+  SurfaceHandle surface;
+  /// The index of the measurement
+  uint32_t measurementIndex;
+  /// The type flags (see TrackStateFlag)
+  uint32_t typeFlags;
+
+  /// @return The transport jacobian as Eigen matrix
+  ACTS_DEVICE_FUNC BoundMatrix jacobianMatrix() const {
+    return Eigen::Map<const BoundMatrix>(jacobian);
+  }
+
+  /// @brief Create the compact representation of a track state
+  ///
+  /// @tparam track_state_t The type of the track state
+  /// @param ts The track state
+  /// @param surface The handle of the reference surface
+  /// @param measurementIndex The index of the measurement
+  template <typename track_state_t>
+  static ACTS_DEVICE_FUNC CompactTrackState
+  fromTrackState(const track_state_t &ts, SurfaceHandle surface,
+                 uint32_t measurementIndex) {
+    CompactTrackState cts;
+    cts.predicted.set(ts.parameter.predicted.parameters(),
+                      *ts.parameter.predicted.covariance());
+    cts.filtered.set(ts.parameter.filtered.parameters(),
+                     *ts.parameter.filtered.covariance());
+    cts.smoothed.set(ts.parameter.smoothed.parameters(),
+                     *ts.parameter.smoothed.covariance());
+    Eigen::Map<BoundMatrix> jacobianMap(cts.jacobian);
+    jacobianMap = ts.parameter.jacobian;
+    cts.pathLength = ts.parameter.pathLength;
+    cts.chi2 = ts.parameter.chi2;
+    cts.geometryId = ts.geometryId().value();
+    cts.surface = surface;
+    cts.measurementIndex = measurementIndex;
+    cts.typeFlags = ts.type().to_ulong();
+    return cts;
+  }
+};
+
+static_assert(std::is_trivially_copyable<CompactTrackState>::value,
+              "CompactTrackState must be trivially copyable");
+static_assert(std::is_standard_layout<CompactTrackState>::value,
+              "CompactTrackState must have a standard layout");
+
+} // namespace Acts
@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "EventData/detail/make_projection_matrix.hpp"
+#include "EventData/detail/residual_calculator.hpp"
+#include "Utilities/Definitions.hpp"
+#include "Utilities/ParameterDefinitions.hpp"
+#include "Utilities/detail/MPL/are_sorted.hpp"
+
+#include <type_traits>
+
+namespace Acts {
+
+/// @brief Projection of the bound parameters onto the measured ones, with the
+/// measured parameters known at compile time
+///
+/// The projection matrix H of a measurement of some of the bound parameters,
+/// e.g. loc0 of a strip or (loc0, loc1) of a pixel, only selects elements. The
+/// products with H are thus gathers of the measured rows and columns, which
+/// this class provides without the dense matrix multiplications.
+///
+/// @tparam indices The measured bound parameters, in increasing order
+template <BoundParametersIndices... indices> struct IndexProjector {
+  static_assert(sizeof...(indices) > 0, "No measured parameters");
+  static_assert(
+      detail::are_sorted<true, true, BoundParametersIndices, indices...>::value,
+      "The measured parameters are not sorted");
+
+  /// The number of measured parameters
+  static constexpr int kSize = sizeof...(indices);
+
+  /// The dense projection matrix
+  using Matrix = ActsMatrix<BoundParametersScalar, kSize, eBoundParametersSize>;
+
+  /// @return The bound parameter of the measured parameter i
+  ACTS_DEVICE_FUNC static constexpr unsigned int index(int i) {
+    constexpr unsigned int kIndices[] = {indices...};
+    return kIndices[i];
+  }
+
+  /// @return The dense projection matrix H
+  static Matrix matrix() {
+    return detail::make_projection_matrix<
+               eBoundParametersSize, static_cast<unsigned int>(indices)...>::
+        init()
+            .template cast<BoundParametersScalar>();
+  }
+
+  /// @brief The measured parameters H * x
+  ///
+  /// @param parameters The bound parameters x
+  template <typename vector_t>
+  ACTS_DEVICE_FUNC static ActsVector<typename vector_t::Scalar, kSize>
+  project(const vector_t &parameters) {
+    ActsVector<typename vector_t::Scalar, kSize> projected;
+    for (int i = 0; i < kSize; ++i) {
+      projected(i) = parameters(index(i));
+    }
+    return projected;
+  }
+
+  /// @brief The measured columns C * H^T of a bound matrix
+  ///
+  /// @param matrix The bound matrix C
+  template <typename matrix_t>
+  ACTS_DEVICE_FUNC static ActsMatrix<typename matrix_t::Scalar,
+                                     eBoundParametersSize, kSize>
+  projectColumns(const matrix_t &matrix) {
+    ActsMatrix<typename matrix_t::Scalar, eBoundParametersSize, kSize>
+        projected;
+    for (int j = 0; j < kSize; ++j) {
+      projected.col(j) = matrix.col(index(j));
+    }
+    return projected;
+  }
+
+  /// @brief The measured rows H * M of a matrix with the bound rows
+  ///
+  /// @note For the measured columns M = C * H^T of a covariance C, this is
+  /// the projected covariance H * C * H^T
+  ///
+  /// @param matrix The matrix M
+  template <typename matrix_t>
+  ACTS_DEVICE_FUNC static ActsMatrix<typename matrix_t::Scalar, kSize,
+                                     matrix_t::ColsAtCompileTime>
+  projectRows(const matrix_t &matrix) {
+    ActsMatrix<typename matrix_t::Scalar, kSize, matrix_t::ColsAtCompileTime>
+        projected;
+    for (int i = 0; i < kSize; ++i) {
+      projected.row(i) = matrix.row(index(i));
+    }
+    return projected;
+  }
+
+  /// @brief The residual of the measured parameters, with the difference of
+  /// the angles within their range
+  ///
+  /// @param measured The measured parameters
+  /// @param parameters The bound parameters
+  template <typename vector_t>
+  static ActsVector<BoundParametersScalar, kSize>
+  residual(const ActsVector<BoundParametersScalar, kSize> &measured,
+           const vector_t &parameters) {
+    return detail::residual_calculator<BoundParametersIndices, indices...>::
+        result(measured, project(parameters));
+  }
+};
+
+namespace detail {
+/// @cond
+template <typename T> struct index_projector_void { using type = void; };
+/// @endcond
+
+/// @brief Whether a source link provides the compile-time projector as
+/// `projector_indices_t`
+template <typename source_link_t, typename = void>
+struct has_index_projector : std::false_type {};
+
+template <typename source_link_t>
+struct has_index_projector<
+    source_link_t,
+    typename index_projector_void<
+        typename source_link_t::projector_indices_t>::type> : std::true_type {
+};
+} // namespace detail
+
+} // namespace Acts
@@ -0,0 +1,125 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Geometry/GeometryID.hpp"
+#include "Utilities/CudaKernelContainer.hpp"
+
+namespace Acts {
+
+/// @brief Non-owning container of the measurements of a track with lookup by
+/// geometry id
+///
+/// The lookup first tries the measurement at a cursor position, i.e. the
+/// measurement expected next if the measurements are ordered like the
+/// surfaces visited by the navigation. Otherwise, it uses a binary search on
+/// an optional index of the measurements sorted by geometry id, or falls back
+/// to a linear scan if no index is given.
+///
+/// @tparam source_link_t Type of the measurements
+template <typename source_link_t> class MeasurementContainer {
+public:
+  using value_type = source_link_t;
+  using const_iterator = const source_link_t *;
+
+  MeasurementContainer() = default;
+
+  /// @brief Constructor from the measurements and the optional index
+  ///
+  /// @param measurements The measurements of the track
+  /// @param sortedIndex The indices of the measurements sorted by geometry id
+  /// (see @c sortIndex), must have the size of the measurements
+  ACTS_DEVICE_FUNC
+  MeasurementContainer(const CudaKernelContainer<source_link_t> &measurements,
+                       const unsigned int *sortedIndex = nullptr)
+      : m_measurements(measurements.data()), m_size(measurements.size()),
+        m_sortedIndex(sortedIndex) {}
+
+  ACTS_DEVICE_FUNC size_t size() const { return m_size; }
+
+  ACTS_DEVICE_FUNC const source_link_t &operator[](size_t i) const {
+    return m_measurements[i];
+  }
+
+  ACTS_DEVICE_FUNC const_iterator begin() const { return m_measurements; }
+  ACTS_DEVICE_FUNC const_iterator end() const {
+    return m_measurements + m_size;
+  }
+
+  /// @return Whether a sorted index is attached
+  ACTS_DEVICE_FUNC bool indexed() const { return m_sortedIndex != nullptr; }
+
+  /// @brief Find the measurement on a surface
+  ///
+  /// @param geoID The geometry id of the surface
+  /// @param cursor The position of the measurement expected next, e.g. the
+  /// number of measurements already handled
+  ///
+  /// @return The measurement or nullptr if there is none on the surface
+  ACTS_DEVICE_FUNC const source_link_t *find(GeometryID geoID,
+                                             size_t cursor = 0) const {
+    // The cursor gives O(1) access for ordered measurements
+    if (cursor < m_size and m_measurements[cursor].geometryId() == geoID) {
+      return &m_measurements[cursor];
+    }
+    if (m_sortedIndex != nullptr) {
+      // Binary search for the first measurement not smaller than geoID
+      size_t lower = 0;
+      size_t upper = m_size;
+      while (lower < upper) {
+        const size_t middle = (lower + upper) / 2;
+        if (m_measurements[m_sortedIndex[middle]].geometryId() < geoID) {
+          lower = middle + 1;
+        } else {
+          upper = middle;
+        }
+      }
+      if (lower < m_size and
+          m_measurements[m_sortedIndex[lower]].geometryId() == geoID) {
+        return &m_measurements[m_sortedIndex[lower]];
+      }
+      return nullptr;
+    }
+    for (size_t i = 0; i < m_size; ++i) {
+      if (m_measurements[i].geometryId() == geoID) {
+        return &m_measurements[i];
+      }
+    }
+    return nullptr;
+  }
+
+  /// @brief Build the index of measurements sorted by geometry id
+  ///
+  /// Insertion sort, which is linear for measurements already (almost) in
+  /// the order of the surfaces and does not allocate
+  ///
+  /// @param measurements The measurements
+  /// @param size The number of measurements
+  /// @param [out] sortedIndex The sorted indices of the measurements
+  static ACTS_DEVICE_FUNC void sortIndex(const source_link_t *measurements,
+                                         size_t size,
+                                         unsigned int *sortedIndex) {
+    for (size_t i = 0; i < size; ++i) {
+      size_t j = i;
+      while (j > 0 and measurements[i].geometryId() <
+                           measurements[sortedIndex[j - 1]].geometryId()) {
+        sortedIndex[j] = sortedIndex[j - 1];
+        --j;
+      }
+      sortedIndex[j] = i;
+    }
+  }
+
+private:
+  const source_link_t *m_measurements = nullptr;
+  size_t m_size = 0;
+  const unsigned int *m_sortedIndex = nullptr;
+};
+
+} // namespace Acts
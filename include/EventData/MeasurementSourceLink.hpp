@@ -0,0 +1,71 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "EventData/IndexProjector.hpp"
+#include "Geometry/GeometryID.hpp"
+#include "Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+
+/// A minimal source link of a measurement of some of the bound parameters
+///
+/// @tparam indices The measured bound parameters, in increasing order
+template <BoundParametersIndices... indices> class MeasurementSourceLink {
+public:
+  /// The compile-time projection onto the measured parameters
+  using projector_indices_t = IndexProjector<indices...>;
+  using projector_t = typename projector_indices_t::Matrix;
+  using meas_par_t =
+      ActsVector<BoundParametersScalar, projector_indices_t::kSize>;
+  using meas_cov_t =
+      ActsMatrix<BoundParametersScalar, projector_indices_t::kSize,
+                 projector_indices_t::kSize>;
+
+  ACTS_DEVICE_FUNC MeasurementSourceLink(const meas_par_t &values,
+                                         const meas_cov_t &cov,
+                                         Acts::GeometryID gid)
+      : m_values(values), m_cov(cov), m_geometryId(gid) {}
+  /// Must be default_constructible to satisfy SourceLinkConcept.
+  MeasurementSourceLink() = default;
+
+  /// The measured parameters
+  ACTS_DEVICE_FUNC constexpr const meas_par_t &values() const {
+    return m_values;
+  }
+
+  ACTS_DEVICE_FUNC constexpr const meas_cov_t &covariance() const {
+    return m_cov;
+  }
+
+  /// Access the geometry identifier.
+  ACTS_DEVICE_FUNC constexpr Acts::GeometryID geometryId() const {
+    return m_geometryId;
+  }
+
+  projector_t projector() const { return projector_indices_t::matrix(); }
+
+  template <typename parameters_t>
+  meas_par_t residual(const parameters_t &par) const {
+    return projector_indices_t::residual(m_values, par.parameters());
+  }
+
+private:
+  meas_par_t m_values;
+  meas_cov_t m_cov;
+  Acts::GeometryID m_geometryId;
+};
+
+/// A strip measuring the first local coordinate
+using StripSourceLink = MeasurementSourceLink<eLOC_0>;
+
+/// A pixel measuring the local position and the time
+using PixelTimeSourceLink = MeasurementSourceLink<eLOC_0, eLOC_1, eT>;
+
+} // namespace Acts
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "EventData/IndexProjector.hpp"
 #include "Geometry/GeometryContext.hpp"
 #include "Geometry/GeometryID.hpp"
 #include "Utilities/ParameterDefinitions.hpp"
@@ -21,6 +22,8 @@ namespace Acts {
 ///
 class PixelSourceLink {
 public:
+  /// The compile-time projection onto the measured local position
+  using projector_indices_t = IndexProjector<eLOC_0, eLOC_1>;
   using projector_t =
       ActsMatrix<BoundParametersScalar, 2, eBoundParametersSize>;
   using meas_par_t = ActsVector<BoundParametersScalar, 2>;
@@ -47,7 +47,8 @@ public:
   /// for charged representations.
   ///
   /// The transformations declared in the coordinate_transformation
-  /// yield the global parameters and momentum representation
+  /// yield the global parameters and momentum representation at the first
+  /// access
   /// @param[in] gctx is the Context object that is forwarded to the surface
   ///            for local to global coordinate transformation
   /// @param[in] cov The covaraniance matrix (optional, can be nullptr)
@@ -60,13 +61,8 @@ public:
                                               const CovarianceMatrix &cov,
                                               const ParametersVector &parValues,
                                               const Surface *surface)
-      : SingleTrackParameters<ChargePolicy>(
-            std::move(cov), parValues,
-            detail::coordinate_transformation::parameters2globalPosition<
-                ReferenceSurfaceType>(gctx, parValues, *surface),
-            detail::coordinate_transformation::parameters2globalMomentum(
-                parValues)),
-        m_pSurface(surface) {
+      : SingleTrackParameters<ChargePolicy>(std::move(cov), parValues),
+        m_geoContext(gctx), m_pSurface(surface) {
     assert(m_pSurface);
   }
 
@@ -100,7 +96,7 @@ public:
                 ReferenceSurfaceType>(gctx, position, momentum, dCharge, dTime,
                                       *surface),
             position, momentum),
-        m_pSurface(std::move(surface)) {
+        m_geoContext(gctx), m_pSurface(std::move(surface)) {
     assert(m_pSurface);
   }
 
@@ -109,7 +105,8 @@ public:
   /// for neutral representations.
   ///
   /// The transformations declared in the coordinate_transformation
-  /// yield the global parameters and momentum representation
+  /// yield the global parameters and momentum representation at the first
+  /// access
   ///
   /// @param[in] gctx is the Context object that is forwarded to the surface
   ///            for local to global coordinate transformation
@@ -123,13 +120,8 @@ public:
                                               const CovarianceMatrix &cov,
                                               const ParametersVector &parValues,
                                               const Surface *surface)
-      : SingleTrackParameters<ChargePolicy>(
-            std::move(cov), parValues,
-            detail::coordinate_transformation::parameters2globalPosition<
-                ReferenceSurfaceType>(gctx, parValues, *surface),
-            detail::coordinate_transformation::parameters2globalMomentum(
-                parValues)),
-        m_pSurface(std::move(surface)) {
+      : SingleTrackParameters<ChargePolicy>(std::move(cov), parValues),
+        m_geoContext(gctx), m_pSurface(std::move(surface)) {
     assert(m_pSurface);
   }
 
@@ -162,21 +154,21 @@ public:
                 ReferenceSurfaceType>(gctx, position, momentum, 0, dTime,
                                       *surface),
             position, momentum),
-        m_pSurface(std::move(surface)) {}
+        m_geoContext(gctx), m_pSurface(std::move(surface)) {}
 
   /// @brief copy constructor  - charged/neutral
   /// @param[in] copy The source parameters
   ACTS_DEVICE_FUNC SingleBoundTrackParameters(
       const SingleBoundTrackParameters<ChargePolicy> &copy)
-      : SingleTrackParameters<ChargePolicy>(copy) {
-    m_pSurface = copy.m_pSurface;
-  }
+      : SingleTrackParameters<ChargePolicy>(copy),
+        m_geoContext(copy.m_geoContext), m_pSurface(copy.m_pSurface) {}
 
   /// @brief move constructor - charged/neutral
   /// @param[in] other The source parameters
   ACTS_DEVICE_FUNC
   SingleBoundTrackParameters(SingleBoundTrackParameters<ChargePolicy> &&other)
       : SingleTrackParameters<ChargePolicy>(std::move(other)),
+        m_geoContext(other.m_geoContext),
         m_pSurface(std::move(other.m_pSurface)) {}
 
   /// @brief desctructor - charged/neutral
@@ -189,6 +181,7 @@ public:
     // check for self-assignment
     if (this != &rhs) {
       SingleTrackParameters<ChargePolicy>::operator=(rhs);
+      m_geoContext = rhs.m_geoContext;
       m_pSurface = rhs.m_pSurface;
     }
     return *this;
@@ -201,6 +194,7 @@ public:
     // check for self-assignment
     if (this != &rhs) {
       SingleTrackParameters<ChargePolicy>::operator=(std::move(rhs));
+      m_geoContext = rhs.m_geoContext;
       m_pSurface = std::move(rhs.m_pSurface);
     }
 
@@ -216,6 +210,17 @@ public:
   ACTS_DEVICE_FUNC void set(const GeometryContext &gctx, Scalar newValue) {
     this->getParameterSet().template setParameter<par>(newValue);
     this->updateGlobalCoordinates(gctx, BoundParameterType<par>());
+    m_geoContext = gctx;
+  }
+
+  /// @brief access position in global coordinate system
+  ///
+  /// @note The position is computed at the first access with the context
+  /// given at the construction or the last update
+  ///
+  /// @return 3D vector with global position
+  ACTS_DEVICE_FUNC Vector3D position() const {
+    return this->template globalPosition<ReferenceSurfaceType>(m_geoContext);
   }
 
   /// @brief access method to the reference surface
@@ -224,6 +229,7 @@ public:
   }
 
 private:
+  GeometryContext m_geoContext = GeometryContext();
   const Surface *m_pSurface = nullptr;
 };
 
@@ -99,8 +99,7 @@ public:
     // check for self-assignment
     if (this != &rhs) {
       SingleTrackParameters<ChargePolicy>::operator=(rhs);
-      m_upSurface =
-          PlaneSurface<InfiniteBounds>(this->position(), this->momentum());
+      m_upSurface = rhs.m_upSurface;
     }
     return *this;
   }
@@ -165,6 +164,14 @@ public:
                                                this->momentum().normalized());
   }
 
+  /// @brief access position in global coordinate system
+  ///
+  /// @return 3D vector with global position
+  ACTS_DEVICE_FUNC Vector3D position() const {
+    return this->template globalPosition<ReferenceSurfaceType>(
+        GeometryContext());
+  }
+
   /// @brief access to the reference surface
   ACTS_DEVICE_FUNC const Surface &referenceSurface() const final {
     return m_upSurface;
@@ -40,6 +40,12 @@ namespace Acts {
 /// The track parameters and their uncertainty are defined in local reference
 /// frame which depends on the associated surface of the track parameters.
 ///
+/// The global position and momentum are computed from the parameters at the
+/// first access and cached, i.e. the parameters created and updated in the
+/// fit do not pay for the transformations unless they are asked for them.
+/// The first access writes the cache, so an object must only be used by one
+/// thread at a time.
+///
 /// @tparam ChargePolicy type for distinguishing charged and neutral
 /// tracks/particles
 ///         (must be either ChargedPolicy or NeutralPolicy)
@@ -60,19 +66,29 @@ public:
   /// @brief default destructor
   virtual ~SingleTrackParameters() = default;
 
-  /// @brief access position in global coordinate system
-  ///
-  /// @return 3D vector with global position
-  ACTS_DEVICE_FUNC Vector3D position() const { return m_vPosition; }
-
   /// @brief access momentum in global coordinate system
-  /// /// @return 3D vector with global momentum
-  ACTS_DEVICE_FUNC Vector3D momentum() const { return m_vMomentum; }
+  ///
+  /// @note The momentum is computed and cached at the first access, which is
+  /// not synchronized, i.e. the object must only be used by one thread
+  ///
+  /// @return 3D vector with global momentum
+  ACTS_DEVICE_FUNC Vector3D momentum() const {
+    if (not m_momentumCached) {
+      m_vMomentum =
+          detail::coordinate_transformation::parameters2globalMomentum(
+              getParameterSet().getParameters());
+      m_momentumCached = true;
+    }
+    return m_vMomentum;
+  }
 
   /// @brief equality operator
   ///
-  /// @return @c true of both objects have the same charge policy, parameter
-  /// values, position and momentum, otherwise @c false
+  /// @note The global position and momentum are not compared, as they follow
+  /// from the parameter values and the reference surface
+  ///
+  /// @return @c true of both objects have the same charge policy, reference
+  /// surface and parameter values, otherwise @c false
   ACTS_DEVICE_FUNC bool operator==(const SingleTrackParameters &rhs) const {
     auto casted = dynamic_cast<decltype(this)>(&rhs);
     if (!casted) {
@@ -81,8 +97,7 @@ public:
 
     return (m_oChargePolicy == casted->m_oChargePolicy &&
             m_oParameters == casted->m_oParameters &&
-            m_vPosition == casted->m_vPosition &&
-            m_vMomentum == casted->m_vMomentum);
+            referenceSurface() == casted->referenceSurface());
   }
 
   /// @brief retrieve electric charge
@@ -173,7 +188,20 @@ protected:
       : m_oChargePolicy(
             detail::coordinate_transformation::parameters2charge(parValues)),
         m_oParameters(std::move(cov), parValues), m_vPosition(position),
-        m_vMomentum(momentum) {}
+        m_vMomentum(momentum), m_positionCached(true), m_momentumCached(true) {}
+
+  /// @brief constructor for track parameters of charged particles with the
+  /// global position and momentum computed at the first access
+  ///
+  /// @param cov The covariance matrix
+  /// @param parValues vector with parameter values
+  template <typename T = ChargePolicy,
+            std::enable_if_t<std::is_same<T, ChargedPolicy>::value, int> = 0>
+  ACTS_DEVICE_FUNC SingleTrackParameters(const CovarianceMatrix &cov,
+                                         const ParametersVector &parValues)
+      : m_oChargePolicy(
+            detail::coordinate_transformation::parameters2charge(parValues)),
+        m_oParameters(cov, parValues) {}
 
   /// @brief standard constructor for track parameters of neutral particles
   ///
@@ -188,7 +216,19 @@ protected:
                                          const Vector3D &position,
                                          const Vector3D &momentum)
       : m_oChargePolicy(), m_oParameters(std::move(cov), parValues),
-        m_vPosition(position), m_vMomentum(momentum) {}
+        m_vPosition(position), m_vMomentum(momentum), m_positionCached(true),
+        m_momentumCached(true) {}
+
+  /// @brief constructor for track parameters of neutral particles with the
+  /// global position and momentum computed at the first access
+  ///
+  /// @param cov The covariance matrix
+  /// @param parValues vector with parameter values
+  template <typename T = ChargePolicy,
+            std::enable_if_t<std::is_same<T, NeutralPolicy>::value, int> = 0>
+  ACTS_DEVICE_FUNC SingleTrackParameters(const CovarianceMatrix &cov,
+                                         const ParametersVector &parValues)
+      : m_oChargePolicy(), m_oParameters(cov, parValues) {}
 
   /// @brief default copy constructor
   SingleTrackParameters(const SingleTrackParameters<ChargePolicy> &copy) =
@@ -208,6 +248,8 @@ protected:
       m_oParameters = rhs.m_oParameters;
       m_vPosition = rhs.m_vPosition;
       m_vMomentum = rhs.m_vMomentum;
+      m_positionCached = rhs.m_positionCached;
+      m_momentumCached = rhs.m_momentumCached;
     }
 
     return *this;
@@ -224,11 +266,35 @@ protected:
       m_oParameters = std::move(rhs.m_oParameters);
       m_vPosition = std::move(rhs.m_vPosition);
       m_vMomentum = std::move(rhs.m_vMomentum);
+      m_positionCached = rhs.m_positionCached;
+      m_momentumCached = rhs.m_momentumCached;
     }
 
     return *this;
   }
 
+  /// @brief access position in global coordinate system
+  ///
+  /// @note The position is computed and cached at the first access, which is
+  /// not synchronized, i.e. the object must only be used by one thread
+  ///
+  /// @tparam surface_derived_t The type of the reference surface
+  /// @param[in] gctx is the Context object that is forwarded to the surface
+  ///            for local to global coordinate transformation
+  ///
+  /// @return 3D vector with global position
+  template <typename surface_derived_t>
+  ACTS_DEVICE_FUNC Vector3D globalPosition(const GeometryContext &gctx) const {
+    if (not m_positionCached) {
+      m_vPosition =
+          detail::coordinate_transformation::parameters2globalPosition<
+              surface_derived_t>(gctx, getParameterSet().getParameters(),
+                                 this->referenceSurface());
+      m_positionCached = true;
+    }
+    return m_vPosition;
+  }
+
   /// @brief update global momentum from current parameter values
   ///
   ///
@@ -236,13 +302,14 @@ protected:
   ///            for local to global coordinate transformation
   ///
   /// @note This function is triggered when called with an argument of a type
-  ///       different from Acts::local_parameter
+  ///       different from Acts::local_parameter. The position is updated as
+  ///       well, as it depends on the direction for some surfaces.
   template <typename T>
   ACTS_DEVICE_FUNC void
   updateGlobalCoordinates(const GeometryContext & /*gctx*/,
                           const T & /*unused*/) {
-    m_vMomentum = detail::coordinate_transformation::parameters2globalMomentum(
-        getParameterSet().getParameters());
+    m_positionCached = false;
+    m_momentumCached = false;
   }
 
   /// @brief update global position from current parameter values
@@ -251,19 +318,21 @@ protected:
   /// Acts::local_parameter
   template <typename surface_derived_t>
   ACTS_DEVICE_FUNC void
-  updateGlobalCoordinates(const GeometryContext &gctx,
+  updateGlobalCoordinates(const GeometryContext & /*gctx*/,
                           const local_parameter & /*unused*/) {
-    m_vPosition = detail::coordinate_transformation::parameters2globalPosition<
-        surface_derived_t>(gctx, getParameterSet().getParameters(),
-                           this->referenceSurface());
+    m_positionCached = false;
   }
 
   ChargePolicy m_oChargePolicy;   ///< charge policy object distinguishing
                                   /// between charged and neutral tracks
   FullParameterSet m_oParameters; ///< ParameterSet object holding the
                                   /// parameter values and covariance matrix
-  Vector3D m_vPosition;           ///< 3D vector with global position
-  Vector3D m_vMomentum;           ///< 3D vector with global momentum
+  /// 3D vector with global position
+  mutable Vector3D m_vPosition = Vector3D::Zero();
+  /// 3D vector with global momentum
+  mutable Vector3D m_vMomentum = Vector3D::Zero();
+  mutable bool m_positionCached = false; ///< Whether the position is valid
+  mutable bool m_momentumCached = false; ///< Whether the momentum is valid
 };
 
 } // namespace Acts
@@ -63,9 +63,6 @@ public:
     m_typeFlags.set(ParameterFlag);
   }
 
-  /// Virtual destructor
-  virtual ~TrackState() = default;
-
   /// Copy constructor
   ///
   /// @param rhs is the source TrackState
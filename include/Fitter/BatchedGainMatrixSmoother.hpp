@@ -0,0 +1,231 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "EventData/TrackParameters.hpp"
+#include "Fitter/detail/LaneParameters.hpp"
+#include "Utilities/Definitions.hpp"
+#include "Utilities/PrecisionPolicy.hpp"
+#include "Utilities/SymmetricSolver.hpp"
+
+#include <cassert>
+#include <cstdio>
+
+namespace Acts {
+
+/// @brief Kalman smoother implementation based on Gain matrix formalism for
+/// W tracks at once
+///
+/// The track states of the tracks are gathered state by state into a
+/// structure-of-arrays layout with one SIMD lane per track, so that the
+/// arithmetic is vectorized over the tracks. The smoothed parameters of the
+/// previous state stay in the lanes. Per lane, the computation is the one of
+/// the GainMatrixSmoother, i.e. the gain is solved with the same LDL^T
+/// decomposition and pivot check, and the result is the same up to the
+/// rounding.
+///
+/// @note All the tracks must have the same number of track states.
+///
+/// @tparam parameters_t Type of the track parameters
+/// @tparam W The number of tracks smoothed at once
+/// @tparam precision_policy_t The precision of the smoothing computation (the
+/// parameters are stored in ActsScalar)
+template <typename parameters_t, int W,
+          typename precision_policy_t = DefaultPrecision>
+class BatchedGainMatrixSmoother {
+public:
+  using UpdateScalar = typename precision_policy_t::UpdateScalar;
+
+  /// The number of tracks smoothed at once
+  static constexpr int kLanes = W;
+
+  /// @brief Smooth the filtered states of up to W tracks
+  ///
+  /// @tparam track_states_t Type of the track states container of a track
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param filteredStates The track states of each track, nullptr for an
+  /// unused lane
+  /// @param [out] success Whether the smoothing of each track succeeded
+  ///
+  /// @return The number of successfully smoothed tracks
+  template <typename track_states_t>
+  int operator()(const GeometryContext &gctx,
+                 track_states_t *const *filteredStates, bool *success) const {
+    using Lanes = detail::LaneParameters<UpdateScalar, W>;
+    using Lane = typename Lanes::Lane;
+    constexpr int N = eBoundParametersSize;
+
+    // The first used lane fills the unused ones
+    int firstLane = -1;
+    for (int l = 0; l < W; ++l) {
+      success[l] = filteredStates[l] != nullptr;
+      if (success[l] and firstLane < 0) {
+        firstLane = l;
+      }
+    }
+    if (firstLane < 0) {
+      return 0;
+    }
+    const int nStates = filteredStates[firstLane]->size();
+    auto laneStates = [&](int l) -> track_states_t & {
+      return *filteredStates[success[l] ? l : firstLane];
+    };
+
+    // For the last state: smoothed is filtered
+    Lanes smoothed;
+    for (int l = 0; l < W; ++l) {
+      auto &ts = laneStates(l)[nStates - 1];
+      if (success[l]) {
+        assert(int(filteredStates[l]->size()) == nStates);
+        ts.parameter.smoothed = ts.parameter.filtered;
+      }
+      smoothed.load(l, ts.parameter.filtered);
+    }
+
+    const UpdateScalar tolerance =
+        SymmetricLDLT<UpdateScalar, N>::s_defaultTolerance;
+    Lanes prevPredicted;
+    Lanes filtered;
+    Lane jacobian[N][N];
+    Lane L[N][N];
+    Lane D[N];
+    Lane X[N][N];
+    Lane GdC[N][N];
+
+    // Loop and smooth the remaining states
+    for (int i = nStates - 2; i >= 0; i--) {
+      // Gather the current and previous states
+      for (int l = 0; l < W; ++l) {
+        const auto &ts = laneStates(l)[i];
+        const auto &prev_ts = laneStates(l)[i + 1];
+        filtered.load(l, ts.parameter.filtered);
+        prevPredicted.load(l, prev_ts.parameter.predicted);
+        const auto &J = prev_ts.parameter.jacobian;
+        for (int r = 0; r < N; ++r) {
+          for (int c = 0; c < N; ++c) {
+            jacobian[r][c](l) = J(r, c);
+          }
+        }
+      }
+
+      // The LDL^T decomposition of the previous predicted covariance, with
+      // the pivot check of the SymmetricLDLT
+      Eigen::Array<bool, W, 1> pivotOk = Eigen::Array<bool, W, 1>::Ones();
+      for (int j = 0; j < N; ++j) {
+        const Lane &a = prevPredicted.cov[Lanes::index(j, j)];
+        Lane d = a;
+        for (int k = 0; k < j; ++k) {
+          d -= L[j][k] * L[j][k] * D[k];
+        }
+        // @note The negated comparisons catch NaN as well
+        pivotOk = pivotOk && (a > 0) && (d / a > tolerance);
+        D[j] = d;
+        for (int r = j + 1; r < N; ++r) {
+          Lane s = prevPredicted.cov[Lanes::index(r, j)];
+          for (int k = 0; k < j; ++k) {
+            s -= L[r][k] * L[j][k] * D[k];
+          }
+          L[r][j] = s / d;
+        }
+      }
+      for (int l = 0; l < W; ++l) {
+        if (success[l] and not pivotOk(l)) {
+          printf("WARNING: Predicted covariance is not positive definite "
+                 "(track %d of the batch)!\n",
+                 l);
+          success[l] = false;
+        }
+      }
+
+      // The right-hand side J * C_filtered
+      for (int r = 0; r < N; ++r) {
+        for (int c = 0; c < N; ++c) {
+          Lane s = jacobian[r][0] * filtered.cov[Lanes::index(0, c)];
+          for (int k = 1; k < N; ++k) {
+            s += jacobian[r][k] * filtered.cov[Lanes::index(k, c)];
+          }
+          X[r][c] = s;
+        }
+      }
+
+      // Solve C_predicted * G^T = J * C_filtered for X = G^T
+      for (int c = 0; c < N; ++c) {
+        for (int r = 1; r < N; ++r) {
+          for (int k = 0; k < r; ++k) {
+            X[r][c] -= L[r][k] * X[k][c];
+          }
+        }
+        for (int r = 0; r < N; ++r) {
+          X[r][c] /= D[r];
+        }
+        for (int r = N - 2; r >= 0; --r) {
+          for (int k = r + 1; k < N; ++k) {
+            X[r][c] -= L[k][r] * X[k][c];
+          }
+        }
+      }
+
+      // The smoothed covariance C_filtered - G * (C_predicted - C_smoothed) *
+      // G^T, with the latter two of the previous state, only for the upper
+      // triangle
+      for (int k = 0; k < Lanes::kCovSize; ++k) {
+        prevPredicted.cov[k] -= smoothed.cov[k];
+      }
+      for (int r = 0; r < N; ++r) {
+        for (int c = 0; c < N; ++c) {
+          Lane s = X[0][r] * prevPredicted.cov[Lanes::index(0, c)];
+          for (int k = 1; k < N; ++k) {
+            s += X[k][r] * prevPredicted.cov[Lanes::index(k, c)];
+          }
+          GdC[r][c] = s;
+        }
+      }
+      for (int r = 0; r < N; ++r) {
+        for (int c = r; c < N; ++c) {
+          Lane s = filtered.cov[Lanes::index(r, c)];
+          for (int k = 0; k < N; ++k) {
+            s -= GdC[r][k] * X[k][c];
+          }
+          smoothed.cov[Lanes::index(r, c)] = s;
+        }
+      }
+
+      // The smoothed parameters x_filtered + G * (x_smoothed - x_predicted),
+      // with the latter two of the previous state
+      for (int k = 0; k < N; ++k) {
+        prevPredicted.pars[k] = smoothed.pars[k] - prevPredicted.pars[k];
+      }
+      for (int r = 0; r < N; ++r) {
+        Lane s = filtered.pars[r];
+        for (int k = 0; k < N; ++k) {
+          s += X[k][r] * prevPredicted.pars[k];
+        }
+        smoothed.pars[r] = s;
+      }
+
+      // Create smoothed track parameters
+      for (int l = 0; l < W; ++l) {
+        if (success[l]) {
+          auto &ts = (*filteredStates[l])[i];
+          ts.parameter.smoothed = smoothed.template get<parameters_t>(
+              l, gctx, &(ts.parameter.filtered.referenceSurface()));
+        }
+      }
+    }
+
+    int nSmoothed = 0;
+    for (int l = 0; l < W; ++l) {
+      nSmoothed += success[l];
+    }
+    return nSmoothed;
+  }
+};
+
+} // namespace Acts
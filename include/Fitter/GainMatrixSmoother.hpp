@@ -1,7 +1,8 @@
 #pragma once
 
 #include "EventData/TrackParameters.hpp"
-#include "Utilities/Math.hpp"
+#include "Utilities/PrecisionPolicy.hpp"
+#include "Utilities/SymmetricSolver.hpp"
 #include <boost/range/adaptors.hpp>
 #include <memory>
 
@@ -10,11 +11,16 @@ namespace Acts {
 /// @brief Kalman smoother implementation based on Gain matrix formalism
 ///
 /// @tparam parameters_t Type of the track parameters
-/// @tparam jacobian_t Type of the Jacobian
-template <typename parameters_t> class GainMatrixSmoother {
+/// @tparam precision_policy_t The precision of the smoothing computation (the
+/// parameters are stored in ActsScalar)
+template <typename parameters_t,
+          typename precision_policy_t = DefaultPrecision>
+class GainMatrixSmoother {
   using jacobian_t = typename parameters_t::CovarianceMatrix;
 
 public:
+  using UpdateScalar = typename precision_policy_t::UpdateScalar;
+
   /// @brief Gain Matrix smoother implementation
   ///
 
@@ -27,7 +33,12 @@ public:
     using track_state_t = typename track_states_t::value_type;
     using ParVector_t = typename parameters_t::ParametersVector;
     using CovMatrix_t = typename parameters_t::CovarianceMatrix;
-    using gain_matrix_t = CovMatrix_t;
+
+    // The smoothing is computed in the scalar type of the policy
+    using UpdateParVector_t = ActsVector<UpdateScalar, eBoundParametersSize>;
+    using UpdateCovMatrix_t =
+        ActsMatrix<UpdateScalar, eBoundParametersSize, eBoundParametersSize>;
+    using gain_matrix_t = UpdateCovMatrix_t;
 
     // smoothed parameter vector and covariance matrix
     ParVector_t smoothedPars;
@@ -54,31 +65,50 @@ public:
       assert(prev_ts->parameter.smoothed);
       assert(prev_ts->parameter.predicted);
 
-      // @todo use multiple threads for this
-      // Gain smoothing matrix
-      G = (*ts.parameter.filtered.covariance()) *
-          prev_ts->parameter.jacobian.transpose() *
-          (BoundSymMatrix)(calculateInverse<ActsScalar>(
-              *prev_ts->parameter.predicted.covariance()));
-      if (G.hasNaN()) {
-        printf("WARNING: G has NaN!\n");
+      // Gain smoothing matrix G = C_filtered * J^T * C_predicted^-1, i.e.
+      // G^T is the solution of C_predicted * G^T = J * C_filtered
+      const UpdateCovMatrix_t prevPredicted =
+          prev_ts->parameter.predicted.covariance()
+              ->template cast<UpdateScalar>();
+      const SymmetricLDLT<UpdateScalar, eBoundParametersSize> prevPredictedCov(
+          prevPredicted);
+      if (not prevPredictedCov.success()) {
+        printf("WARNING: Predicted covariance is not positive definite "
+               "(pivot %d, relative pivot %g)!\n",
+               prevPredictedCov.failedPivot(),
+               double(prevPredictedCov.minPivotRatio()));
         return nullptr;
       }
+      const UpdateCovMatrix_t filteredCov =
+          ts.parameter.filtered.covariance()->template cast<UpdateScalar>();
+      G = prevPredictedCov
+              .solve(gain_matrix_t(
+                  prev_ts->parameter.jacobian.template cast<UpdateScalar>() *
+                  filteredCov))
+              .transpose();
 
       // Calculate the smoothed parameters
-      ParVector_t prevDiffPars = prev_ts->parameter.smoothed.parameters() -
-                                 prev_ts->parameter.predicted.parameters();
-      ParVector_t gainPars = G * prevDiffPars;
-      smoothedPars = ts.parameter.filtered.parameters() + gainPars;
+      UpdateParVector_t prevDiffPars =
+          prev_ts->parameter.smoothed.parameters()
+              .template cast<UpdateScalar>() -
+          prev_ts->parameter.predicted.parameters()
+              .template cast<UpdateScalar>();
+      UpdateParVector_t gainPars = G * prevDiffPars;
+      smoothedPars =
+          (ts.parameter.filtered.parameters().template cast<UpdateScalar>() +
+           gainPars)
+              .template cast<ActsScalar>();
 
       // @todo use multiple threads for this
       // And the smoothed covariance
       smoothedCov =
-          (BoundSymMatrix)(*(ts.parameter.filtered.covariance())) -
-          (BoundSymMatrix)(G *
-                           (*(prev_ts->parameter.predicted.covariance()) -
-                            *(prev_ts->parameter.smoothed.covariance())) *
-                           G.transpose());
+          (filteredCov -
+           (UpdateCovMatrix_t)(G *
+                               (prevPredicted -
+                                prev_ts->parameter.smoothed.covariance()
+                                    ->template cast<UpdateScalar>()) *
+                               G.transpose()))
+              .template cast<ActsScalar>();
 
       // Create smoothed track parameters
       ts.parameter.smoothed =
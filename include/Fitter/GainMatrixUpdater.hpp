@@ -8,18 +8,27 @@
 
 #pragma once
 
+#include "EventData/IndexProjector.hpp"
 #include "EventData/TrackParameters.hpp"
 #include "Fitter/detail/VoidKalmanComponents.hpp"
 #include "Utilities/Definitions.hpp"
 #include "Utilities/Helpers.hpp"
+#include "Utilities/PrecisionPolicy.hpp"
 
 #include <memory>
+#include <type_traits>
 
 namespace Acts {
 
 /// @brief Update step of Kalman Filter using gain matrix formalism
+///
+/// @tparam precision_policy_t The precision of the update computation (the
+/// parameters are stored in ActsScalar)
+template <typename precision_policy_t = DefaultPrecision>
 class GainMatrixUpdater {
 public:
+  using UpdateScalar = typename precision_policy_t::UpdateScalar;
+
   /// @brief Public call operator for the boost visitor pattern
   ///
   /// @tparam track_state_t Type of the track state for the update
@@ -36,77 +45,15 @@ public:
                                    track_state_t &trackState,
                                    const Surface *surface) const {
     // printf("Invoked GainMatrixUpdater\n");
-    using parameters_t = typename track_state_t::Parameters;
     using source_link_t = typename track_state_t::SourceLink;
-
-    using CovMatrix_t = typename parameters_t::CovarianceMatrix;
-    using ParVector_t = typename parameters_t::ParametersVector;
-
-    using projector_t = typename source_link_t::projector_t;
-    using meas_par_t = typename source_link_t::meas_par_t;
-    using meas_cov_t = typename source_link_t::meas_cov_t;
-
-    constexpr size_t measdim = meas_par_t::RowsAtCompileTime;
-
-    // read-only prediction handle
-    const parameters_t &predicted = trackState.parameter.predicted;
-    const CovMatrix_t &predicted_covariance = *predicted.covariance();
-
-    ParVector_t filtered_parameters;
-    CovMatrix_t filtered_covariance;
-
-    // The source link
-    const auto &sl = trackState.measurement.uncalibrated;
-
-    // Take the projector (measurement mapping function)
-    const auto &H = sl.projector();
-    meas_cov_t cov = H * predicted_covariance * H.transpose() + sl.covariance();
-    meas_cov_t covInv = get2DMatrixInverse(cov);
-    // The Kalman gain matrix
-    const ActsMatrixD<eBoundParametersSize, measdim> K =
-        predicted_covariance * H.transpose() * covInv;
-
-    // filtered new parameters after update
-    const ParVector_t gain = K * sl.residual(predicted);
-    filtered_parameters = predicted.parameters() + gain;
-
-    // @todo use multiple threads for this
-    // printf("K = (%f\n, %f\n, %f\n, %f\n, %f\n, %f)\n", K(0,0), K(0,1),
-    // K(1,0), K(1,1), K(2,0), K(2,1), K(3,0), K(3,1), K(4,0),
-    // K(4,1),K(5,0),K(5,1));
-    const CovMatrix_t KH = K * H;
-    const CovMatrix_t C = CovMatrix_t::Identity() - KH;
-    // printf("C = (%f\n, %f\n, %f\n, %f\n, %f\n, %f)\n", C(0,0), C(0,1),
-    // C(1,0), C(1,1), C(2,0), C(2,1), C(3,0), C(3,1), C(4,0),
-    // C(4,1),C(5,0),C(5,1));
-
-    // updated covariance after filtering
-    filtered_covariance = C * predicted_covariance;
-
-    // Create new filtered parameters and covariance
-    parameters_t filtered(gctx, std::move(filtered_covariance),
-                          filtered_parameters, surface);
-
-    //    // calculate the chi2
-    //    // chi2 = r^T * R^-1 * r
-    //    // r is the residual of the filtered state
-    //    // R is the covariance matrix of the filtered residual
-    //    meas_cov_t R = (meas_cov_t::Identity() - H * K) * sl.covariance();
-    //    meas_par_t residual = sl.residual(filtered);
-    //    trackState.parameter.chi2 =
-    //        (residual.transpose() *
-    //         get2DMatrixInverse(R) *
-    //         residual)
-    //            .eval()(0, 0);
-    //
-    trackState.parameter.filtered = filtered;
-
-    // always succeed, no outlier logic yet
-    return true;
+    return update(gctx, trackState, surface,
+                  projection(trackState.measurement.uncalibrated,
+                             detail::has_index_projector<source_link_t>()));
   }
 
 #ifdef __CUDACC__
   // The updater with multiple threads on GPU
+  // @note It computes in ActsScalar regardless of the precision policy
   template <typename track_state_t>
   __device__ bool updateOnDevice(const GeometryContext &gctx,
                                  track_state_t &trackState,
@@ -238,6 +185,159 @@ public:
     return true;
   }
 #endif
+
+private:
+  /// @brief The projection with the dense projection matrix H of the source
+  /// link
+  template <int measdim> struct DenseProjection {
+    static constexpr int kSize = measdim;
+    using Projector = ActsMatrix<UpdateScalar, measdim, eBoundParametersSize>;
+
+    Projector H;
+
+    /// @return The measured columns C * H^T of the covariance
+    template <typename cov_t>
+    ACTS_DEVICE_FUNC ActsMatrix<UpdateScalar, eBoundParametersSize, measdim>
+    columns(const cov_t &C) const {
+      return C * H.transpose();
+    }
+
+    /// @return The projected covariance H * C * H^T
+    template <typename cov_t, typename columns_t>
+    ACTS_DEVICE_FUNC ActsMatrix<UpdateScalar, measdim, measdim>
+    measured(const cov_t &C, const columns_t & /*CHt*/) const {
+      return H * C * H.transpose();
+    }
+
+    /// @return The filtered covariance (1 - K * H) * C
+    template <typename cov_t, typename gain_t, typename columns_t>
+    ACTS_DEVICE_FUNC cov_t filtered(const cov_t &C, const gain_t &K,
+                                    const columns_t & /*CHt*/) const {
+      const cov_t KH = K * H;
+      return (cov_t::Identity() - KH) * C;
+    }
+  };
+
+  /// @brief The projection with the compile-time indices of the source link
+  ///
+  /// The projection only selects the measured parameters, so the products
+  /// with H are gathers of the measured rows and columns of the covariance.
+  template <typename projector_t> struct IndexProjection {
+    static constexpr int kSize = projector_t::kSize;
+
+    template <typename cov_t>
+    ACTS_DEVICE_FUNC ActsMatrix<UpdateScalar, eBoundParametersSize, kSize>
+    columns(const cov_t &C) const {
+      return projector_t::projectColumns(C);
+    }
+
+    /// @note The measured rows of the measured columns
+    template <typename cov_t, typename columns_t>
+    ACTS_DEVICE_FUNC ActsMatrix<UpdateScalar, kSize, kSize>
+    measured(const cov_t & /*C*/, const columns_t &CHt) const {
+      return projector_t::projectRows(CHt);
+    }
+
+    /// @note C - K * H * C, with H * C the transpose of the measured columns
+    template <typename cov_t, typename gain_t, typename columns_t>
+    ACTS_DEVICE_FUNC cov_t filtered(const cov_t &C, const gain_t &K,
+                                    const columns_t &CHt) const {
+      return C - K * CHt.transpose();
+    }
+  };
+
+  /// @return The dense projection of a source link
+  template <typename source_link_t>
+  ACTS_DEVICE_FUNC static DenseProjection<
+      source_link_t::meas_par_t::RowsAtCompileTime>
+  projection(const source_link_t &sl, std::false_type /*indexProjector*/) {
+    return {sl.projector().template cast<UpdateScalar>()};
+  }
+
+  /// @return The index projection of a source link
+  template <typename source_link_t>
+  ACTS_DEVICE_FUNC static IndexProjection<
+      typename source_link_t::projector_indices_t>
+  projection(const source_link_t & /*sl*/, std::true_type /*indexProjector*/) {
+    return {};
+  }
+
+  /// @brief The update with a projection of the source link
+  template <typename track_state_t, typename projection_t>
+  ACTS_DEVICE_FUNC bool update(const GeometryContext &gctx,
+                               track_state_t &trackState,
+                               const Surface *surface,
+                               const projection_t &projection) const {
+    using parameters_t = typename track_state_t::Parameters;
+
+    using CovMatrix_t = typename parameters_t::CovarianceMatrix;
+    using ParVector_t = typename parameters_t::ParametersVector;
+
+    constexpr int measdim = projection_t::kSize;
+
+    // The update is computed in the scalar type of the policy
+    using UpdateCovMatrix_t =
+        ActsMatrix<UpdateScalar, eBoundParametersSize, eBoundParametersSize>;
+    using UpdateParVector_t = ActsVector<UpdateScalar, eBoundParametersSize>;
+    using UpdateMeasCov_t = ActsMatrix<UpdateScalar, measdim, measdim>;
+    using UpdateGain_t =
+        ActsMatrix<UpdateScalar, eBoundParametersSize, measdim>;
+
+    // read-only prediction handle
+    const parameters_t &predicted = trackState.parameter.predicted;
+    const UpdateCovMatrix_t predicted_covariance =
+        predicted.covariance()->template cast<UpdateScalar>();
+
+    // The source link
+    const auto &sl = trackState.measurement.uncalibrated;
+
+    // C * H^T and H * C * H^T
+    const UpdateGain_t CHt = projection.columns(predicted_covariance);
+    UpdateMeasCov_t cov = projection.measured(predicted_covariance, CHt) +
+                          sl.covariance().template cast<UpdateScalar>();
+    UpdateMeasCov_t covInv = measurementCovInverse(cov);
+    // The Kalman gain matrix
+    const UpdateGain_t K = CHt * covInv;
+
+    // filtered new parameters after update
+    const ActsVector<UpdateScalar, measdim> residual =
+        sl.residual(predicted).template cast<UpdateScalar>();
+    const UpdateParVector_t gain = K * residual;
+    ParVector_t filtered_parameters =
+        (predicted.parameters().template cast<UpdateScalar>() + gain)
+            .template cast<ActsScalar>();
+
+    // updated covariance after filtering
+    CovMatrix_t filtered_covariance =
+        projection.filtered(predicted_covariance, K, CHt)
+            .template cast<ActsScalar>();
+
+    // Create new filtered parameters and covariance
+    parameters_t filtered(gctx, std::move(filtered_covariance),
+                          filtered_parameters, surface);
+
+    // The chi2 of the predicted residual, which equals the chi2 of the
+    // filtered residual r^T * R^-1 * r with R = (1 - H * K) * V
+    trackState.parameter.chi2 = residual.dot(covInv * residual);
+
+    trackState.parameter.filtered = filtered;
+
+    // always succeed, no outlier logic yet
+    return true;
+  }
+
+  /// @brief The inverse of the residual covariance of a measurement
+  template <int measdim>
+  ACTS_DEVICE_FUNC static Eigen::Matrix<UpdateScalar, measdim, measdim>
+  measurementCovInverse(
+      const Eigen::Matrix<UpdateScalar, measdim, measdim> &cov) {
+    return cov.inverse();
+  }
+
+  ACTS_DEVICE_FUNC static ActsMatrix<UpdateScalar, 2, 2>
+  measurementCovInverse(const ActsMatrix<UpdateScalar, 2, 2> &cov) {
+    return get2DMatrixInverse(cov);
+  }
 };
 
 } // namespace Acts
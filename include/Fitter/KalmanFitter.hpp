@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "EventData/MeasurementContainer.hpp"
 #include "EventData/TrackParameters.hpp"
 #include "EventData/TrackState.hpp"
 #include "Fitter/detail/VoidKalmanComponents.hpp"
@@ -96,6 +97,15 @@ struct KalmanFitterOptions {
 
   /// Whether to consider energy loss
   bool energyLoss = true;
+
+  /// Whether to extrapolate the smoothed parameters directly to the reference
+  /// surface, i.e. without the navigation through the propagation loop
+  bool directTargetExtrapolation = false;
+
+  /// The optional indices of the measurements sorted by geometry id (see
+  /// MeasurementContainer::sortIndex) for the lookup of measurements not in
+  /// the order of the surfaces
+  const unsigned int *measurementIndex = nullptr;
 };
 
 template <typename source_link_t, typename parameters_t,
@@ -120,6 +130,9 @@ struct KalmanFitterResult {
 
   // Indicator if the fitting is successful
   bool result = true;
+
+  // The counters of the propagation
+  PropagatorStatistics statistics;
 };
 
 /// @brief Kalman fitter implementation of Acts as a plugin
@@ -156,6 +169,9 @@ class KalmanFitter {
 public:
   using NavigationSurface = typename propagator_t::NavigationSurface;
 
+  /// The trace policy is inherited from the propagator
+  using Trace = typename propagator_t::Trace;
+
   /// Default constructor is deleted
   KalmanFitter() = delete;
 
@@ -186,7 +202,7 @@ private:
     using TrackStateType = typename result_type::TrackStateType;
 
     /// Broadcast the input measurement container type
-    using InputMeasurementsType = CudaKernelContainer<source_link_t>;
+    using InputMeasurementsType = MeasurementContainer<source_link_t>;
 
     /// The target surface
     const Surface *targetSurface = nullptr;
@@ -203,6 +219,9 @@ private:
     /// Whether to consider energy loss.
     bool energyLoss = true;
 
+    /// Whether to extrapolate the smoothed parameters directly to the target
+    bool directTargetExtrapolation = false;
+
     /// Add constructor with updater and smoother
     ACTS_DEVICE_FUNC Actor(updater_t pUpdater = updater_t(),
                            smoother_t pSmoother = smoother_t())
@@ -250,6 +269,9 @@ private:
           if (!res) {
             // printf("Error in finalize:\n");
             result.result = false;
+          } else if (directTargetExtrapolation and
+                     !extrapolateToTarget(state, stepper, result)) {
+            result.result = false;
           }
         }
       }
@@ -288,13 +310,14 @@ private:
     ACTS_DEVICE_FUNC bool
     filter(const Surface *surface, propagator_state_t &state,
            const stepper_t &stepper, result_type &result) const {
-      // Try to find the surface in the measurement surfaces
-      SurfaceFinder sFinder{surface->geoID()};
+      // Try to find the surface in the measurement surfaces, the next
+      // measurement is expected after the ones already handled
       // printf("surface geoID = (%d, %d, %d)\n", surface->geoID().volume(),
       //       surface->geoID().layer(), surface->geoID().sensitive());
-      auto sourcelink_it = inputMeasurements.find_if(sFinder);
+      auto sourcelink_it =
+          inputMeasurements.find(surface->geoID(), result.measurementStates);
       // No source link, still return true
-      if (sourcelink_it == inputMeasurements.end()) {
+      if (sourcelink_it == nullptr) {
         return true;
       }
       // Screen out the source link
@@ -395,6 +418,50 @@ private:
       return false;
     }
 
+    /// @brief Kalman actor operation : extrapolation to the target
+    ///
+    /// Steps the smoothed parameters set by finalize directly to the target
+    /// surface and binds them there. Compared to the propagation loop, the
+    /// navigator, the aborters and the actor are not called per step.
+    ///
+    /// @tparam propagator_state_t is the type of Propagagor state
+    /// @tparam stepper_t Type of the stepper
+    ///
+    /// @param state is the mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param result is the mutable result state object
+    ///
+    /// @return Whether the target was reached within the maximum steps,
+    /// false as soon as a step fails
+    template <typename propagator_state_t, typename stepper_t>
+    ACTS_DEVICE_FUNC bool
+    extrapolateToTarget(propagator_state_t &state, const stepper_t &stepper,
+                        result_type &result) const {
+      for (unsigned int i = 0; i < state.options.maxSteps; ++i) {
+        // The target check also constrains the step size to the target
+        if (targetReached.
+            operator()<propagator_state_t, stepper_t, target_surface_t>(
+                state, stepper, *targetSurface)) {
+          typename TrackStateType::Jacobian jac;
+          ActsScalar path;
+          // Transport & bind the parameter to the final surface
+          stepper.template boundState<target_surface_t>(
+              state.stepping, *targetSurface, result.fittedParameters, jac,
+              path);
+          result.finished = true;
+          return true;
+        }
+        // A failed step (e.g. below the minimum step size) leaves the state
+        // unchanged, i.e. the target would never be reached
+        if (not stepper.step(state)) {
+          return false;
+        }
+        // The steps are counted after the last surface of the sequence
+        state.stepping.statistics.countStep(state.navigation.nextSurfaceIter);
+      }
+      return false;
+    }
+
     /// @brief Kalman actor operation : material interaction
     ///
     /// @tparam propagator_state_t is the type of Propagagor state
@@ -496,6 +563,9 @@ private:
             if (!res) {
               // printf("Error in finalize:\n");
               result.result = false;
+            } else if (directTargetExtrapolation and
+                       !extrapolateToTarget(state, stepper, result)) {
+              result.result = false;
             }
           }
         }
@@ -548,10 +618,10 @@ private:
         // Initialize the status
         sourcelinkFound = false;
         // Try to find the surface in the measurement surfaces
-        SurfaceFinder sFinder{surface->geoID()};
-        auto sourcelink_it = inputMeasurements.find_if(sFinder);
+        auto sourcelink_it =
+            inputMeasurements.find(surface->geoID(), result.measurementStates);
         // No source link, still return true
-        if (sourcelink_it != inputMeasurements.end()) {
+        if (sourcelink_it != nullptr) {
           sourcelinkFound = true;
           // create track state on the vector from sourcelink
           result.fittedStates[result.measurementStates] =
@@ -745,11 +815,14 @@ public:
 
     // Catch the actor and set the measurements
     auto &kalmanActor = kalmanOptions.action;
-    kalmanActor.inputMeasurements = std::move(sourcelinks);
+    kalmanActor.inputMeasurements = MeasurementContainer<source_link_t>(
+        sourcelinks, kfOptions.measurementIndex);
     kalmanActor.targetSurface = kfOptions.referenceSurface;
     kalmanActor.multipleScattering = kfOptions.multipleScattering;
     kalmanActor.energyLoss = kfOptions.energyLoss;
     kalmanActor.smoothing = kfOptions.smoothing;
+    kalmanActor.directTargetExtrapolation =
+        kfOptions.directTargetExtrapolation;
 
     // Set config for outlier finder
     kalmanActor.m_outlierFinder = kfOptions.outlierFinder;
@@ -783,6 +856,8 @@ public:
     // printf("Propagation time: %0.5lf microseconds\n", elapsed_seconds.count());
 
 
+    kfResult.statistics = propRes.statistics;
+
     POP_RANGE();
 
     if (!kfResult.result or (kfResult.result and kfResult.measurementStates !=
@@ -790,29 +865,61 @@ public:
       // printf("KalmanFilter failed: \n");
       return false;
     }
-    // printf("Total KF states is: %d\n", kfResult.fittedStates.size());
-    int count = 0;
-    printf("Kalman Filter Result:\n");
-    for(auto iter = kfResult.fittedStates.begin(); iter != kfResult.fittedStates.end(); iter++) {
-      printf("surface id: %d\n", count);
-      printf("smoothed value is: %f\n", (*iter).parameter.smoothed);
-      printf("cov[0, 0] is: %f\n", (*iter).parameter.jacobian(0, 0));
-      printf("cov[0, 1] is: %f\n", (*iter).parameter.jacobian(0, 1));
-      printf("cov[0, 2] is: %f\n", (*iter).parameter.jacobian(0, 2));
-      printf("cov[1, 0] is: %f\n", (*iter).parameter.jacobian(1, 0));
-      printf("cov[1, 1] is: %f\n", (*iter).parameter.jacobian(1, 1));
-      printf("cov[1, 2] is: %f\n", (*iter).parameter.jacobian(1, 2));
-      printf("cov[2, 0] is: %f\n", (*iter).parameter.jacobian(2, 0));
-      printf("cov[2, 1] is: %f\n", (*iter).parameter.jacobian(2, 1));
-      printf("cov[2, 2] is: %f\n", (*iter).parameter.jacobian(2, 2));
-      printf("\n");
-      count++;
+    // Record the fitted states with the trace policy of the propagator
+    if (Trace::enabled) {
+      for (unsigned int i = 0; i < kfResult.fittedStates.size(); ++i) {
+        Trace::fittedState(i, kfResult.fittedStates[i]);
+      }
     }
 
     // Return the converted Track
     return true;
   }
 
+  /// Extrapolation of the smoothed parameters of the first track state to
+  /// the reference surface
+  ///
+  /// This completes a fit run without smoothing, whose track states were
+  /// smoothed afterwards outside of the fitter, e.g. together with the states
+  /// of other tracks by the BatchedGainMatrixSmoother. The smoothed
+  /// parameters are stepped directly to the reference surface, as with the
+  /// directTargetExtrapolation option.
+  ///
+  /// @tparam source_link_t Source link type identifying uncalibrated input
+  /// measurements.
+  /// @tparam parameters_t Type of parameters used for local parameters
+  ///
+  /// @param kfOptions KalmanOptions steering the fit
+  /// @param kfResult The result of the fit with the smoothed track states
+  ///
+  /// @return Whether the reference surface was reached
+  template <typename source_link_t, typename parameters_t,
+            typename target_surface_t>
+  ACTS_DEVICE_FUNC bool extrapolateSmoothed(
+      const KalmanFitterOptions<outlier_finder_t> &kfOptions,
+      KalmanFitterResult<source_link_t, parameters_t, target_surface_t>
+          &kfResult) const {
+    using KalmanAborter = Aborter<source_link_t, parameters_t>;
+    using KalmanActor = Actor<source_link_t, parameters_t, target_surface_t>;
+    using KalmanOptions = PropagatorOptions<KalmanActor, KalmanAborter>;
+
+    // The propagation starts backward from the smoothed parameters
+    KalmanOptions kalmanOptions(kfOptions.geoContext,
+                                kfOptions.magFieldContext);
+    kalmanOptions.direction = backward;
+    kalmanOptions.action.targetSurface = kfOptions.referenceSurface;
+    typename propagator_t::template State<KalmanOptions> state(
+        kfResult.fittedStates[0].parameter.smoothed, kalmanOptions);
+    // The steps are counted after the last surface of the sequence
+    state.navigation.nextSurfaceIter = kfResult.fittedStates.size();
+
+    kfResult.smoothed = true;
+    const bool reached = kalmanOptions.action.extrapolateToTarget(
+        state, m_propagator.getStepper(), kfResult);
+    kfResult.statistics += state.stepping.statistics;
+    return reached;
+  }
+
 #ifdef __CUDACC__
   /// Fit implementation of the foward filter, calls the
   /// the forward filter and backward smoother (device only version)
@@ -866,11 +973,15 @@ public:
       kalmanOptions.initializer.targetSurface = kfOptions.referenceSurface;
 
       // Catch the actor and set the measurements
-      kalmanOptions.action.inputMeasurements = std::move(sourcelinks);
+      kalmanOptions.action.inputMeasurements =
+          MeasurementContainer<source_link_t>(sourcelinks,
+                                              kfOptions.measurementIndex);
       kalmanOptions.action.targetSurface = kfOptions.referenceSurface;
       kalmanOptions.action.multipleScattering = kfOptions.multipleScattering;
       kalmanOptions.action.energyLoss = kfOptions.energyLoss;
       kalmanOptions.action.smoothing = kfOptions.smoothing;
+      kalmanOptions.action.directTargetExtrapolation =
+          kfOptions.directTargetExtrapolation;
 
       // Set config for outlier finder
       kalmanOptions.action.m_outlierFinder = kfOptions.outlierFinder;
@@ -0,0 +1,85 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Geometry/GeometryContext.hpp"
+#include "Utilities/PackedSymMatrix.hpp"
+#include "Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+
+class Surface;
+
+namespace detail {
+
+/// @brief Bound parameters and covariances of W tracks in a
+/// structure-of-arrays layout, i.e. with one SIMD lane per track
+///
+/// Element k of the parameters (or of the packed upper triangle of the
+/// covariance) of all lanes is a fixed-size Eigen array, so that the
+/// arithmetic on the lanes is vectorized by Eigen.
+///
+/// @tparam T The scalar type of the computation
+/// @tparam W The number of lanes
+template <typename T, int W> struct LaneParameters {
+  /// The values of one element for all lanes
+  using Lane = Eigen::Array<T, W, 1>;
+
+  static constexpr int kSize = eBoundParametersSize;
+  static constexpr int kCovSize = PackedSymMatrix<T, kSize>::kSize;
+
+  /// @return The position of the covariance element (i,j)
+  static constexpr int index(int i, int j) {
+    return PackedSymMatrix<T, kSize>::index(i, j);
+  }
+
+  Lane pars[kSize];
+  Lane cov[kCovSize];
+
+  /// @brief Load the parameters and covariance of a track into a lane
+  ///
+  /// @param lane The lane of the track
+  /// @param parameters The track parameters (with covariance)
+  template <typename parameters_t>
+  void load(int lane, const parameters_t &parameters) {
+    const auto &values = parameters.parameters();
+    const auto &covariance = *parameters.covariance();
+    for (int i = 0; i < kSize; ++i) {
+      pars[i](lane) = values(i);
+      for (int j = i; j < kSize; ++j) {
+        cov[index(i, j)](lane) = covariance(i, j);
+      }
+    }
+  }
+
+  /// @brief The track parameters of a lane
+  ///
+  /// @param lane The lane of the track
+  /// @param gctx The geometry context
+  /// @param surface The reference surface of the parameters
+  template <typename parameters_t>
+  parameters_t get(int lane, const GeometryContext &gctx,
+                   const Surface *surface) const {
+    using ParVector_t = typename parameters_t::ParametersVector;
+    using CovMatrix_t = typename parameters_t::CovarianceMatrix;
+    ParVector_t values;
+    CovMatrix_t covariance;
+    for (int i = 0; i < kSize; ++i) {
+      values(i) = pars[i](lane);
+      covariance(i, i) = cov[index(i, i)](lane);
+      for (int j = i + 1; j < kSize; ++j) {
+        covariance(i, j) = covariance(j, i) = cov[index(i, j)](lane);
+      }
+    }
+    return parameters_t(gctx, covariance, values, surface);
+  }
+};
+
+} // namespace detail
+} // namespace Acts
@@ -0,0 +1,173 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Geometry/GeometryID.hpp"
+#include "Utilities/Definitions.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+/// @brief 32-bit handle of a surface in a SurfaceStore
+///
+/// Unlike a pointer, the handle stays valid when the store is copied to the
+/// device, shared between threads or written to a file.
+struct SurfaceHandle {
+  using Value = uint32_t;
+  /// The value of a handle not referring to any surface
+  static constexpr Value s_invalid = UINT32_MAX;
+
+  Value value = s_invalid;
+
+  ACTS_DEVICE_FUNC bool valid() const { return value != s_invalid; }
+
+  ACTS_DEVICE_FUNC bool operator==(SurfaceHandle other) const {
+    return value == other.value;
+  }
+  ACTS_DEVICE_FUNC bool operator!=(SurfaceHandle other) const {
+    return value != other.value;
+  }
+};
+
+/// @brief Non-owning view of the surfaces of a SurfaceStore
+///
+/// The view is trivially copyable, i.e. it can be passed to a kernel to
+/// resolve the handles on the device if the arrays are on the device.
+///
+/// @tparam surface_derived_t The type of the surfaces
+template <typename surface_derived_t> class SurfaceStoreView {
+public:
+  using value_type = surface_derived_t;
+
+  SurfaceStoreView() = default;
+
+  /// @brief Constructor from the arrays of the store
+  ///
+  /// @param surfaces The surfaces
+  /// @param size The number of surfaces
+  ACTS_DEVICE_FUNC SurfaceStoreView(const surface_derived_t *surfaces,
+                                    uint32_t size)
+      : m_surfaces(surfaces), m_size(size) {}
+
+  ACTS_DEVICE_FUNC uint32_t size() const { return m_size; }
+
+  ACTS_DEVICE_FUNC const surface_derived_t *data() const { return m_surfaces; }
+
+  /// @return The surface of a valid handle
+  ACTS_DEVICE_FUNC const surface_derived_t &
+  operator[](SurfaceHandle handle) const {
+    return m_surfaces[handle.value];
+  }
+
+  /// @note The surface is only cast to the store type after its address is
+  /// found inside the store, as the cast of any other surface is undefined
+  ///
+  /// @return The handle of a surface of the store, or an invalid handle if
+  /// the surface is not in the store
+  ACTS_DEVICE_FUNC SurfaceHandle handle(const Surface *surface) const {
+    const std::less<const void *> less;
+    const void *address = surface;
+    if (surface == nullptr or less(address, m_surfaces) or
+        not less(address, m_surfaces + m_size)) {
+      return SurfaceHandle();
+    }
+    const auto *derived = static_cast<const surface_derived_t *>(surface);
+    return SurfaceHandle{static_cast<uint32_t>(derived - m_surfaces)};
+  }
+
+private:
+  const surface_derived_t *m_surfaces = nullptr;
+  uint32_t m_size = 0;
+};
+
+/// @brief Immutable store of the surfaces of a geometry
+///
+/// The surfaces are stored contiguously, each with its transform, bounds and
+/// material, and referenced by 32-bit handles. The geometry ids are kept in a
+/// separate array together with an index sorted by geometry id. The store is
+/// not modified after its construction, i.e. it can be shared between threads
+/// without synchronization. The frame caches of the surfaces are built at the
+/// construction.
+///
+/// @tparam surface_derived_t The type of the surfaces
+template <typename surface_derived_t> class SurfaceStore {
+public:
+  using value_type = surface_derived_t;
+  using View = SurfaceStoreView<surface_derived_t>;
+
+  SurfaceStore() = default;
+
+  /// @brief Constructor from the surfaces with assigned geometry ids
+  ///
+  /// @param surfaces The surfaces, whose handles are their indices
+  explicit SurfaceStore(std::vector<surface_derived_t> surfaces)
+      : m_surfaces(std::move(surfaces)) {
+    m_geoIDs.reserve(m_surfaces.size());
+    m_sortedIDs.reserve(m_surfaces.size());
+    for (uint32_t is = 0; is < m_surfaces.size(); ++is) {
+      m_surfaces[is].cacheFrame();
+      const auto &surface = m_surfaces[is];
+      m_geoIDs.push_back(surface.geoID().value());
+      m_sortedIDs.emplace_back(surface.geoID().value(), is);
+    }
+    std::sort(m_sortedIDs.begin(), m_sortedIDs.end());
+  }
+
+  uint32_t size() const { return m_surfaces.size(); }
+
+  const surface_derived_t *data() const { return m_surfaces.data(); }
+
+  /// @return The surface of a valid handle
+  const surface_derived_t &operator[](SurfaceHandle handle) const {
+    return m_surfaces[handle.value];
+  }
+
+  /// @return The handle of a surface of the store, or an invalid handle if
+  /// the surface is not in the store
+  SurfaceHandle handle(const Surface *surface) const {
+    return view().handle(surface);
+  }
+
+  /// @return The handle of the surface with a geometry id, or an invalid
+  /// handle if there is none
+  SurfaceHandle find(GeometryID geoID) const {
+    const auto it = std::lower_bound(
+        m_sortedIDs.begin(), m_sortedIDs.end(),
+        std::make_pair(geoID.value(), uint32_t(0)));
+    if (it == m_sortedIDs.end() or it->first != geoID.value()) {
+      return SurfaceHandle();
+    }
+    return SurfaceHandle{it->second};
+  }
+
+  /// @return The geometry id of the surface of a valid handle
+  GeometryID geoID(SurfaceHandle handle) const {
+    return GeometryID(m_geoIDs[handle.value]);
+  }
+
+  /// @return The view of the store on the host
+  View view() const {
+    return View(m_surfaces.data(), m_surfaces.size());
+  }
+
+private:
+  std::vector<surface_derived_t> m_surfaces;
+  std::vector<GeometryID::Value> m_geoIDs;
+  /// The geometry ids and handles sorted by geometry id
+  std::vector<std::pair<GeometryID::Value, uint32_t>> m_sortedIDs;
+};
+
+} // namespace Acts
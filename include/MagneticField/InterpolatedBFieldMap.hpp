@@ -166,7 +166,7 @@ public:
   InterpolatedBFieldMapper(TransformPosType transformPos,
                            TransformBFieldType transformBField, Grid_t &&grid)
       : m_transformPos(std::move(transformPos)),
-        m_transformBField(std::move(transformBField)), m_grid(grid) {}
+        m_transformBField(std::move(transformBField)), m_grid(std::move(grid)) {}
 
   /// @brief retrieve field at given position
   ///
@@ -273,7 +273,7 @@ template <typename Mapper_t> class InterpolatedBFieldMap final {
 public:
   /// @brief configuration object for magnetic field interpolation
   struct Config {
-    Config(Mapper_t m) : mapper(m) {}
+    Config(Mapper_t m) : mapper(std::move(m)) {}
 
     /// @brief global B-field scaling factor
     ///
@@ -307,8 +307,8 @@ public:
 
   /// @brief get configuration object
   ///
-  /// @return copy of the internal configuration object
-  ACTS_DEVICE_FUNC Config getConfiguration() const { return m_config; }
+  /// @return reference to the internal configuration object
+  ACTS_DEVICE_FUNC const Config &getConfiguration() const { return m_config; }
 
   /// @brief retrieve magnetic field value
   ///
@@ -371,7 +371,7 @@ public:
   /// @brief convenience method to access underlying field mapper
   ///
   /// @return the field mapper
-  ACTS_DEVICE_FUNC Mapper_t getMapper() const { return m_config.mapper; }
+  ACTS_DEVICE_FUNC const Mapper_t &getMapper() const { return m_config.mapper; }
 
   /// @brief Get a non-const reference on the underlying field mapper
   ///
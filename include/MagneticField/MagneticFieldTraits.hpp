@@ -0,0 +1,30 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <type_traits>
+
+namespace Acts {
+namespace detail {
+/// @cond
+template <typename T> struct field_trait_void { using type = void; };
+/// @endcond
+
+/// @brief Whether a magnetic field is homogeneous, i.e. whether it advertises
+/// itself as constant with `static constexpr bool isConstant = true`
+template <typename bfield_t, typename = void>
+struct is_constant_field : std::false_type {};
+
+template <typename bfield_t>
+struct is_constant_field<
+    bfield_t,
+    typename field_trait_void<decltype(bfield_t::isConstant)>::type>
+    : std::integral_constant<bool, bfield_t::isConstant> {};
+} // namespace detail
+} // namespace Acts
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Surfaces/Surface.hpp"
+#include "Utilities/CudaKernelContainer.hpp"
 #include "Utilities/Definitions.hpp"
 
 #include <iomanip>
@@ -53,8 +54,8 @@ struct DirectNavigatorInitializer {
     // Only act once
     if (not r.initialized) {
       // Initialize the surface sequence
-      state.navigation.surfaceSequence = surfaceSequence;
-      state.navigation.surfaceSequenceSize = surfaceSequenceSize;
+      state.navigation.setSurfaceSequence(surfaceSequence,
+                                          surfaceSequenceSize);
       state.navigation.targetSurface = targetSurface;
       r.initialized = true;
     }
@@ -97,14 +98,30 @@ public:
   struct State {
     /// Externally provided surfaces - expected to be ordered
     /// along the path
-    const Surface *surfaceSequence = nullptr;
+    CudaKernelContainer<const surface_derived_t> surfaceSequence;
 
-    /// The surface sequence size
-    size_t surfaceSequenceSize = 0;
-
-    /// Iterator the the next surface
+    /// The cursor, i.e. the index of the next surface in the sequence
     SurfaceIter nextSurfaceIter = 0;
 
+    /// @brief Set the surface sequence
+    ///
+    /// @param surfaces The first surface of a contiguous array of
+    /// surface_derived_t objects
+    /// @param size The number of surfaces
+    ACTS_DEVICE_FUNC void setSurfaceSequence(const Surface *surfaces,
+                                             size_t size) {
+      surfaceSequence = CudaKernelContainer<const surface_derived_t>(
+          static_cast<const surface_derived_t *>(surfaces), size);
+      nextSurfaceIter = 0;
+    }
+
+    /// @return The next surface in the sequence or nullptr at the end
+    ACTS_DEVICE_FUNC const surface_derived_t *nextSurface() const {
+      return nextSurfaceIter < surfaceSequence.size()
+                 ? &surfaceSequence[nextSurfaceIter]
+                 : nullptr;
+    }
+
     /// Navigation state - external interface: the start surface
     const Surface *startSurface = nullptr;
     /// Navigation state - external interface: the current surface
@@ -118,36 +135,6 @@ public:
     bool navigationBreak = false;
   };
 
-  template <typename T>
-  static ACTS_DEVICE_FUNC void *advanceByDatatype(void *addr) {
-    // return static_cast<T*>(addr) + sizeof(T);
-    return addr + sizeof(T);
-  }
-
-  template <typename T>
-  static ACTS_DEVICE_FUNC const void *advanceByDatatype(const void *addr) {
-    // return static_cast<const T*>(addr) + sizeof(T);
-    return addr + sizeof(T);
-  }
-
-  static ACTS_DEVICE_FUNC Surface *advanceSurfacePtr(Surface *ptr) {
-    //  switch (ptr->type()) {
-    //  case Surface::Plane:
-    return (Surface *)advanceByDatatype<surface_derived_t>(ptr);
-    //   default:
-    //    return ptr + 1;
-    //  }
-  }
-
-  static ACTS_DEVICE_FUNC const Surface *advanceSurfacePtr(const Surface *ptr) {
-    //  switch (ptr->type()) {
-    //  case Surface::Plane:
-    return (Surface const *)advanceByDatatype<surface_derived_t>(ptr);
-    //  default:
-    //    return ptr + 1;
-    //  }
-  }
-
   /// @brief Navigator status call
   ///
   /// @tparam propagator_state_t is the type of Propagatgor state
@@ -162,12 +149,8 @@ public:
     // Navigator status always resets the current surface
     state.navigation.currentSurface = nullptr;
     // Check if we are on surface
-    if (state.navigation.nextSurfaceIter !=
-        state.navigation.surfaceSequenceSize) {
-      auto *surfacePtr = state.navigation.surfaceSequence;
-      for (int i = 0; i < state.navigation.nextSurfaceIter; ++i) {
-        surfacePtr = advanceSurfacePtr(surfacePtr);
-      }
+    const surface_derived_t *surfacePtr = state.navigation.nextSurface();
+    if (surfacePtr != nullptr) {
       // Establish the surface status
       auto surfaceStatus =
           stepper.template updateSurfaceStatus<surface_derived_t>(
@@ -180,7 +163,7 @@ public:
         //@Todo: I guess this could be removed as it's already done in the
         // updateSurfaceStatus
         if (state.navigation.nextSurfaceIter !=
-            state.navigation.surfaceSequenceSize) {
+            state.navigation.surfaceSequence.size()) {
           stepper.releaseStepSize(state.stepping);
         }
       }
@@ -200,12 +183,8 @@ public:
 
     // Navigator target always resets the current surface
     state.navigation.currentSurface = nullptr;
-    if (state.navigation.nextSurfaceIter !=
-        state.navigation.surfaceSequenceSize) {
-      auto *surfacePtr = state.navigation.surfaceSequence;
-      for (int i = 0; i < state.navigation.nextSurfaceIter; ++i) {
-        surfacePtr = advanceSurfacePtr(surfacePtr);
-      }
+    const surface_derived_t *surfacePtr = state.navigation.nextSurface();
+    if (surfacePtr != nullptr) {
       // Establish & update the surface status
       auto surfaceStatus =
           stepper.template updateSurfaceStatus<surface_derived_t>(
@@ -2,6 +2,7 @@
 
 #include "EventData/TrackParameters.hpp"
 #include "Propagator/ConstrainedStep.hpp"
+#include "Propagator/PropagatorStatistics.hpp"
 #include "Propagator/detail/CovarianceEngine.hpp"
 #include "Propagator/detail/SteppingHelper.hpp"
 #include "Surfaces/Surface.hpp"
@@ -9,16 +10,22 @@
 #include "Utilities/Helpers.hpp"
 #include "Utilities/Intersection.hpp"
 #include "Utilities/ParameterDefinitions.hpp"
+#include "Utilities/PrecisionPolicy.hpp"
 
 #include <iostream>
 #include <numeric>
 
 namespace Acts {
-template <typename bfield_t> struct EigenStepper {
+/// @tparam bfield_t The type of the magnetic field
+/// @tparam precision_policy_t The precision of the covariance transport (the
+/// stepping and the state are in ActsScalar)
+template <typename bfield_t, typename precision_policy_t = DefaultPrecision>
+struct EigenStepper {
   /// Jacobian and Covariance defintions
   using Jacobian = BoundMatrix;
   using Covariance = BoundSymMatrix;
   using BField = bfield_t;
+  using TransportScalar = typename precision_policy_t::TransportScalar;
 
   /// @brief State for track parameter propagation
   ///
@@ -74,6 +81,9 @@ template <typename bfield_t> struct EigenStepper {
 
     size_t nStepTrials = -1;
 
+    /// The counters of the propagation
+    PropagatorStatistics statistics;
+
     /// Propagated time
     ActsScalar t = 0.;
 
@@ -131,8 +141,9 @@ template <typename bfield_t> struct EigenStepper {
   /// @param [in,out] state is the propagation state associated with the track
   ///                 the magnetic field cell is used (and potentially updated)
   /// @param [in] pos is the field position
-  ACTS_DEVICE_FUNC Vector3D getField(State & /*state*/,
+  ACTS_DEVICE_FUNC Vector3D getField(State &state,
                                      const Vector3D &pos) const {
+    state.statistics.fieldEvaluations++;
     // get the field from the cell
     return m_bField.getField(pos);
   }
@@ -1,4 +1,5 @@
 #include "Propagator/detail/CovarianceEngine.hpp"
+#include "Propagator/detail/TransportMatrix.hpp"
 #include "Utilities/ParameterDefinitions.hpp"
 
 namespace Acts {
@@ -47,11 +48,11 @@ ACTS_DEVICE_FUNC void propagationTime(propagator_state_t &state,
 }
 
 // 3) The following functor calculates the transport matrix D for the jacobian
+// by its non-trivial blocks
 template <typename propagator_state_t>
 ACTS_DEVICE_FUNC void transportMatrix(const propagator_state_t &state,
                                       const StepData &sd, const ActsScalar &h,
-                                      FreeMatrix &D) {
-  D = FreeMatrix::Identity();
+                                      BlockTransportMatrix &D) {
   auto dir = state.stepping.dir;
   auto qop = state.stepping.q / state.stepping.p;
 
@@ -96,31 +97,44 @@ ACTS_DEVICE_FUNC void transportMatrix(const propagator_state_t &state,
   }
   // The dF/dT in D
   {
-    auto dFdT = D.block<3, 3>(0, 4);
+    auto dFdT = D.upper.block<3, 3>(0, 0);
     dFdT.setIdentity();
     dFdT += h / 6. * (dk1dT + dk2dT + dk3dT);
     dFdT *= h;
   }
   // The dF/dL in D
   {
-    auto dFdL = D.block<3, 1>(0, 7);
+    auto dFdL = D.upper.block<3, 1>(0, 3);
     dFdL = (h * h) / 6. * (dk1dL + dk2dL + dk3dL);
   }
   // The dG/dT in D
   {
-    // dGdx is already initialised as (3x3) zero
-    auto dGdT = D.block<3, 3>(4, 4);
+    auto dGdT = D.lower.block<3, 3>(0, 0);
+    dGdT.setIdentity();
     dGdT += h / 6. * (dk1dT + 2. * (dk2dT + dk3dT) + dk4dT);
   }
   // The dG/dL in D
   {
-    auto dGdL = D.block<3, 1>(4, 7);
+    auto dGdL = D.lower.block<3, 1>(0, 3);
     dGdL = h / 6. * (dk1dL + 2. * (dk2dL + dk3dL) + dk4dL);
   }
   // The dt/d(q/p)
-  D(3, 7) = h * state.options.mass * state.options.mass * state.stepping.q /
-            (state.stepping.p *
-             std::hypot(1., state.options.mass / state.stepping.p));
+  D.upper.row(3) << 0., 0., 0.,
+      h * state.options.mass * state.options.mass * state.stepping.q /
+          (state.stepping.p *
+           std::hypot(1., state.options.mass / state.stepping.p));
+  // The q/p is not changed
+  D.lower.row(3) << 0., 0., 0., 1.;
+}
+
+// The dense transport matrix D for the jacobian
+template <typename propagator_state_t>
+ACTS_DEVICE_FUNC void transportMatrix(const propagator_state_t &state,
+                                      const StepData &sd, const ActsScalar &h,
+                                      FreeMatrix &D) {
+  BlockTransportMatrix blocks;
+  transportMatrix(state, sd, h, blocks);
+  D = blocks.dense();
 }
 
 template <typename propagator_state_t>
@@ -223,10 +237,10 @@ __device__ void transportdTOnDevice(const ActsScalar &h,
 } // namespace detail
 } // namespace Acts
 
-template <typename B>
+template <typename B, typename P>
 template <typename propagator_state_t>
 ACTS_DEVICE_FUNC bool
-Acts::EigenStepper<B>::step(propagator_state_t &state) const {
+Acts::EigenStepper<B, P>::step(propagator_state_t &state) const {
   // Construt a stepping data here
   // printf("EigenInverter in usage");
   // std::cout << "EigenInverter in usage" << std::endl;
@@ -278,6 +292,8 @@ Acts::EigenStepper<B>::step(propagator_state_t &state) const {
   // ATL-SOFT-PUB-2009-001
   // printf("num of step trials for statistics:\n");
   while (!tryRungeKuttaStep(state.stepping.stepSize)) {
+    state.stepping.statistics.stepTrials++;
+    state.stepping.statistics.rejectedSteps++;
     stepSizeScaling =
         std::min(std::max(0.25, std::pow((state.options.tolerance /
                                           std::abs(2. * error_estimate)),
@@ -304,11 +320,12 @@ Acts::EigenStepper<B>::step(propagator_state_t &state) const {
       // printf("num of stepTrails under abort condition is: %ld\n", nStepTrials);
       return false;
     }
-    printf("Additional Trial Step\n");
+    // @note the number of trials is recorded by the propagator trace policy
     nStepTrials++;
     state.stepping.nStepTrials = nStepTrials;
   }
   // printf("num of stepTrails under success is: %ld\n", nStepTrials);
+  state.stepping.statistics.stepTrials++;
 
   // use the adjusted step size
   const ActsScalar h = state.stepping.stepSize;
@@ -321,9 +338,9 @@ Acts::EigenStepper<B>::step(propagator_state_t &state) const {
   if (state.stepping.covTransport) {
     // The state.stepping.jacTransport is only identity after calling the
     // boundState
-    FreeMatrix D;
+    detail::BlockTransportMatrix D;
     detail::transportMatrix(state, sd, h, D);
-    state.stepping.jacTransport = D * state.stepping.jacTransport;
+    D.accumulate(state.stepping.jacTransport);
   }
 
   // Update the track parameters according to the equations of motion
@@ -344,10 +361,10 @@ Acts::EigenStepper<B>::step(propagator_state_t &state) const {
 }
 
 #ifdef __CUDACC__
-template <typename B>
+template <typename B, typename P>
 template <typename propagator_state_t>
 __device__ bool
-Acts::EigenStepper<B>::stepOnDevice(propagator_state_t &state) const {
+Acts::EigenStepper<B, P>::stepOnDevice(propagator_state_t &state) const {
 
   const bool IS_MAIN_THREAD = (threadIdx.x == 0 && threadIdx.y == 0);
 
@@ -493,9 +510,9 @@ Acts::EigenStepper<B>::stepOnDevice(propagator_state_t &state) const {
   return true;
 }
 
-template <typename B>
+template <typename B, typename P>
 template <typename surface_derived_t>
-__device__ void Acts::EigenStepper<B>::boundStateOnDevice(
+__device__ void Acts::EigenStepper<B, P>::boundStateOnDevice(
     State &state, const Surface &surface,
     BoundParameters<surface_derived_t> &boundParams, BoundMatrix &jacobian,
     ActsScalar &path) const {
@@ -525,9 +542,9 @@ __device__ void Acts::EigenStepper<B>::boundStateOnDevice(
 }
 #endif
 
-template <typename B>
+template <typename B, typename P>
 template <typename surface_derived_t>
-ACTS_DEVICE_FUNC void Acts::EigenStepper<B>::boundState(
+ACTS_DEVICE_FUNC void Acts::EigenStepper<B, P>::boundState(
     State &state, const Surface &surface,
     BoundParameters<surface_derived_t> &boundParams, BoundMatrix &jacobian,
     ActsScalar &path) const {
@@ -542,7 +559,10 @@ ACTS_DEVICE_FUNC void Acts::EigenStepper<B>::boundState(
   parameters[7] = state.q / state.p;
 
   // printf("state.cov(5.5) = %f\n", state.cov(5,5));
-  detail::boundState<surface_derived_t>(
+  if (state.covTransport) {
+    state.statistics.covarianceTransports++;
+  }
+  detail::boundState<surface_derived_t, TransportScalar>(
       state.geoContext, state.cov, state.jacobian, state.jacTransport,
       state.derivative, state.jacToGlobal, parameters, state.covTransport,
       surface, boundParams);
@@ -552,22 +572,25 @@ ACTS_DEVICE_FUNC void Acts::EigenStepper<B>::boundState(
   path = state.pathAccumulated;
 }
 
-template <typename B>
+template <typename B, typename P>
 ACTS_DEVICE_FUNC auto
-Acts::EigenStepper<B>::curvilinearState(State &state) const
+Acts::EigenStepper<B, P>::curvilinearState(State &state) const
     -> CurvilinearState {
   FreeVector parameters;
   parameters << state.pos[0], state.pos[1], state.pos[2], state.t, state.dir[0],
       state.dir[1], state.dir[2], state.q / state.p;
-  return detail::curvilinearState(
+  if (state.covTransport) {
+    state.statistics.covarianceTransports++;
+  }
+  return detail::curvilinearState<TransportScalar>(
       state.cov, state.jacobian, state.jacTransport, state.derivative,
       state.jacToGlobal, parameters, state.covTransport, state.pathAccumulated);
 }
 
-template <typename B>
+template <typename B, typename P>
 ACTS_DEVICE_FUNC void
-Acts::EigenStepper<B>::update(State &state, const FreeVector &parameters,
-                              const Covariance &covariance) const {
+Acts::EigenStepper<B, P>::update(State &state, const FreeVector &parameters,
+                                 const Covariance &covariance) const {
   state.pos = parameters.template segment<3>(eFreePos0);
   state.dir = parameters.template segment<3>(eFreeDir0).normalized();
   state.p = std::abs(1. / parameters[eFreeQOverP]);
@@ -576,28 +599,30 @@ Acts::EigenStepper<B>::update(State &state, const FreeVector &parameters,
   state.cov = covariance;
 }
 
-template <typename B>
+template <typename B, typename P>
 ACTS_DEVICE_FUNC void
-Acts::EigenStepper<B>::update(State &state, const Vector3D &uposition,
-                              const Vector3D &udirection, ActsScalar up,
-                              ActsScalar time) const {
+Acts::EigenStepper<B, P>::update(State &state, const Vector3D &uposition,
+                                 const Vector3D &udirection, ActsScalar up,
+                                 ActsScalar time) const {
   state.pos = uposition;
   state.dir = udirection;
   state.p = up;
   state.t = time;
 }
 
-template <typename B>
+template <typename B, typename P>
 ACTS_DEVICE_FUNC void
-Acts::EigenStepper<B>::covarianceTransport(State &state) const {
-  detail::covarianceTransport(state.cov, state.jacobian, state.jacTransport,
-                              state.derivative, state.jacToGlobal, state.dir);
+Acts::EigenStepper<B, P>::covarianceTransport(State &state) const {
+  state.statistics.covarianceTransports++;
+  detail::covarianceTransport<TransportScalar>(
+      state.cov, state.jacobian, state.jacTransport, state.derivative,
+      state.jacToGlobal, state.dir);
 }
 
-template <typename B>
+template <typename B, typename P>
 ACTS_DEVICE_FUNC void
-Acts::EigenStepper<B>::covarianceTransport(State &state,
-                                           const Surface &surface) const {
+Acts::EigenStepper<B, P>::covarianceTransport(State &state,
+                                              const Surface &surface) const {
   FreeVector parameters;
   parameters[0] = state.pos[0];
   parameters[1] = state.pos[1];
@@ -607,6 +632,7 @@ Acts::EigenStepper<B>::covarianceTransport(State &state,
   parameters[5] = state.dir[1];
   parameters[6] = state.dir[2];
   parameters[7] = state.q / state.p;
+  state.statistics.covarianceTransports++;
   detail::covarianceTransport(state.geoContext, state.cov, state.jacobian,
                               state.jacTransport, state.derivative,
                               state.jacToGlobal, parameters, surface);
@@ -0,0 +1,94 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Propagator/EigenStepper.hpp"
+#include "Propagator/detail/RungeKuttaTableau.hpp"
+#include "Utilities/Definitions.hpp"
+#include "Utilities/PrecisionPolicy.hpp"
+
+namespace Acts {
+
+/// @brief Runge-Kutta stepper with an embedded pair of orders and step size
+/// control
+///
+/// The step integrates the equations of motion dr/ds = T, dT/ds = q/p T x B
+/// with an embedded Runge-Kutta pair. The difference of the two orders is the
+/// local error estimate, which sets the next step size by a
+/// proportional-integral (PI) controller, i.e. the accuracy step also grows
+/// after an accepted step, unlike in the EigenStepper.
+///
+/// The last stage of the pair is evaluated at the end of the step (first same
+/// as last), so its magnetic field is kept and reused by the first stage of
+/// the next step if the particle has not been moved by an update in between.
+///
+/// The state, the bound and curvilinear states and the updates are those of
+/// the EigenStepper.
+///
+/// @tparam bfield_t The type of the magnetic field
+/// @tparam tableau_t The Butcher tableau of the embedded pair, with the last
+/// stage at the end of the step
+/// @tparam precision_policy_t The precision of the covariance transport
+template <typename bfield_t, typename tableau_t = detail::DormandPrince54,
+          typename precision_policy_t = DefaultPrecision>
+struct EmbeddedRungeKuttaStepper
+    : public EigenStepper<bfield_t, precision_policy_t> {
+  static_assert(detail::isFirstSameAsLast<tableau_t>(),
+                "The last stage of the tableau is not at the end of the step");
+
+  using Base = EigenStepper<bfield_t, precision_policy_t>;
+  using BField = bfield_t;
+  using Tableau = tableau_t;
+
+  /// @brief State for track parameter propagation
+  ///
+  /// The state of the EigenStepper, with the field of the last stage and the
+  /// error of the last step
+  struct State : public Base::State {
+    /// Default constructor
+    State() = default;
+
+    /// Constructor from the initial track parameters
+    using Base::State::State;
+
+    /// The position of the last stage of the previous step
+    Vector3D lastStagePos = Vector3D(0., 0., 0.);
+
+    /// The magnetic field at the last stage of the previous step
+    Vector3D lastStageField = Vector3D(0., 0., 0.);
+
+    /// Whether the field of the last stage is set
+    bool lastStageValid = false;
+
+    /// The ratio of the error estimate of the previous step and the
+    /// tolerance, for the integral part of the step size control
+    ActsScalar previousErrorRatio = 1e-4;
+  };
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  ACTS_DEVICE_FUNC EmbeddedRungeKuttaStepper(BField bField = BField())
+      : Base(std::move(bField)) {}
+
+  /// Perform an embedded Runge-Kutta track parameter propagation step
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  ///
+  ///                      the state contains the desired step size.
+  ///                      It can be negative during backwards track
+  ///                      propagation. The accuracy step size is shrunk
+  ///                      for rejected trials and set for the next step
+  ///                      from the error estimate of the accepted one.
+  template <typename propagator_state_t>
+  ACTS_DEVICE_FUNC bool step(propagator_state_t &state) const;
+};
+
+} // namespace Acts
+
+#include "Propagator/EmbeddedRungeKuttaStepper.ipp"
@@ -0,0 +1,215 @@
+#include "Propagator/detail/TransportMatrix.hpp"
+#include "Utilities/Helpers.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// @brief Storage of the stages of an embedded Runge-Kutta step
+template <int stages> struct EmbeddedStepData {
+  /// Magnetic field evaluations
+  Vector3D B[stages];
+  /// The direction T_i of each stage
+  Vector3D dir[stages];
+  /// The derivative k_i = q/p T_i x B_i of the direction of each stage
+  Vector3D k[stages];
+};
+
+// The following functor calculates the transport matrix D for the jacobian
+// from the stages, by the derivatives of each stage w.r.t. the direction and
+// q/p at the start of the step (the field gradient is neglected)
+template <typename tableau_t, typename propagator_state_t>
+ACTS_DEVICE_FUNC void
+embeddedTransportMatrix(const propagator_state_t &state,
+                        const EmbeddedStepData<tableau_t::kStages> &sd,
+                        const ActsScalar &h, BlockTransportMatrix &D) {
+  constexpr int kStages = tableau_t::kStages;
+  auto qop = state.stepping.q / state.stepping.p;
+
+  // The derivatives of k_i w.r.t. the direction and q/p
+  ActsMatrixD<3, 3> dkdT[kStages];
+  ActsVectorD<3> dkdL[kStages];
+
+  auto dFdT = D.upper.block<3, 3>(0, 0);
+  auto dFdL = D.upper.block<3, 1>(0, 3);
+  auto dGdT = D.lower.block<3, 3>(0, 0);
+  auto dGdL = D.lower.block<3, 1>(0, 3);
+  dFdT.setZero();
+  dFdL.setZero();
+  dGdT.setIdentity();
+  dGdL.setZero();
+  for (int i = 0; i < kStages; ++i) {
+    // The derivatives of the direction T_i of the stage
+    ActsMatrixD<3, 3> dTdT = ActsMatrixD<3, 3>::Identity();
+    ActsVectorD<3> dTdL = ActsVectorD<3>::Zero();
+    for (int j = 0; j < i; ++j) {
+      dTdT += h * tableau_t::a(i, j) * dkdT[j];
+      dTdL += h * tableau_t::a(i, j) * dkdL[j];
+    }
+    dkdT[i] = qop * VectorHelpers::cross(dTdT, sd.B[i]);
+    dkdL[i] = sd.dir[i].cross(sd.B[i]) + qop * dTdL.cross(sd.B[i]);
+
+    dFdT += tableau_t::b(i) * dTdT;
+    dFdL += tableau_t::b(i) * dTdL;
+    dGdT += h * tableau_t::b(i) * dkdT[i];
+    dGdL += h * tableau_t::b(i) * dkdL[i];
+  }
+  dFdT *= h;
+  dFdL *= h;
+  // The dt/d(q/p)
+  D.upper.row(3) << 0., 0., 0.,
+      h * state.options.mass * state.options.mass * state.stepping.q /
+          (state.stepping.p *
+           std::hypot(1., state.options.mass / state.stepping.p));
+  // The q/p is not changed
+  D.lower.row(3) << 0., 0., 0., 1.;
+}
+
+} // namespace detail
+} // namespace Acts
+
+template <typename B, typename T, typename P>
+template <typename propagator_state_t>
+ACTS_DEVICE_FUNC bool
+Acts::EmbeddedRungeKuttaStepper<B, T, P>::step(
+    propagator_state_t &state) const {
+  constexpr int kStages = T::kStages;
+  // The exponents of the step size control, e.g. 1/5 for an error of order
+  // h^5, with the proportional and integral parts of the PI controller
+  constexpr ActsScalar kExponent = 1. / T::kErrorOrder;
+  constexpr ActsScalar kProportional = 0.7 * kExponent;
+  constexpr ActsScalar kIntegral = 0.4 * kExponent;
+  constexpr ActsScalar kSafety = 0.9;
+  constexpr ActsScalar kMinScaling = 0.2;
+  constexpr ActsScalar kMaxScaling = 5.;
+
+  auto &stepping = state.stepping;
+  const auto qop = stepping.q / stepping.p;
+
+  detail::EmbeddedStepData<kStages> sd;
+  // The position of the last stage, i.e. at the end of the step
+  Vector3D lastPos = stepping.pos;
+  // Default constructor will result in wrong value on GPU
+  ActsScalar errorRatio = 0.;
+
+  // First Runge-Kutta point (at current position), with the field of the
+  // last stage of the previous step if the particle has not been moved
+  if (stepping.lastStageValid && stepping.lastStagePos == stepping.pos) {
+    sd.B[0] = stepping.lastStageField;
+  } else {
+    sd.B[0] = this->getField(stepping, stepping.pos);
+  }
+  sd.dir[0] = stepping.dir;
+  sd.k[0] = qop * sd.dir[0].cross(sd.B[0]);
+
+  // The following functor performs a Runge-Kutta step of a certain size and
+  // returns whether the local error estimate, i.e. the difference of the two
+  // orders, is within the tolerance
+  const auto tryRungeKuttaStep = [&](const ActsScalar h) -> bool {
+    for (int i = 1; i < kStages; ++i) {
+      Vector3D dPos = Vector3D::Zero();
+      Vector3D dDir = Vector3D::Zero();
+      for (int j = 0; j < i; ++j) {
+        dPos += T::a(i, j) * sd.dir[j];
+        dDir += T::a(i, j) * sd.k[j];
+      }
+      lastPos = stepping.pos + h * dPos;
+      sd.dir[i] = stepping.dir + h * dDir;
+      sd.B[i] = this->getField(stepping, lastPos);
+      sd.k[i] = qop * sd.dir[i].cross(sd.B[i]);
+    }
+
+    // The error of the position, plus the one of the direction over the step
+    Vector3D errorPos = Vector3D::Zero();
+    Vector3D errorDir = Vector3D::Zero();
+    for (int i = 0; i < kStages; ++i) {
+      errorPos += T::e(i) * sd.dir[i];
+      errorDir += T::e(i) * sd.k[i];
+    }
+    const ActsScalar error =
+        std::max(std::abs(h) * (errorPos.template lpNorm<1>() +
+                                std::abs(h) * errorDir.template lpNorm<1>()),
+                 static_cast<ActsScalar>(1e-20));
+    errorRatio = error / state.options.tolerance;
+    return (errorRatio <= 1.);
+  };
+
+  bool rejected = false;
+  size_t nStepTrials = 0;
+  stepping.nStepTrials = nStepTrials;
+  while (!tryRungeKuttaStep(stepping.stepSize)) {
+    stepping.statistics.stepTrials++;
+    stepping.statistics.rejectedSteps++;
+    rejected = true;
+    // Shrink the step by the error estimate alone
+    const ActsScalar stepSizeScaling =
+        std::max(kMinScaling, kSafety * std::pow(errorRatio, -kExponent));
+    stepping.stepSize = stepping.stepSize * stepSizeScaling;
+
+    // If step size becomes too small the particle remains at the initial
+    // place
+    if (stepping.stepSize * stepping.stepSize <
+        state.options.stepSizeCutOff * state.options.stepSizeCutOff) {
+      // Not moving due to too low momentum needs an aborter
+      return false;
+    }
+
+    // If the parameter is off track too much or given stepSize is not
+    // appropriate
+    if (nStepTrials > state.options.maxRungeKuttaStepTrials) {
+      // Too many trials, have to abort
+      return false;
+    }
+    // @note the number of trials is recorded by the propagator trace policy
+    nStepTrials++;
+    stepping.nStepTrials = nStepTrials;
+  }
+  stepping.statistics.stepTrials++;
+
+  // use the adjusted step size
+  const ActsScalar h = stepping.stepSize;
+
+  // The PI control of the next step: the error of this step and the one of
+  // the previous step, without growing right after a rejection
+  ActsScalar stepSizeScaling =
+      kSafety * std::pow(errorRatio, -kProportional) *
+      std::pow(stepping.previousErrorRatio, kIntegral);
+  stepSizeScaling =
+      std::min(std::max(stepSizeScaling, kMinScaling),
+               rejected ? static_cast<ActsScalar>(1.) : kMaxScaling);
+  stepping.previousErrorRatio =
+      std::max(errorRatio, static_cast<ActsScalar>(1e-4));
+  // The accuracy step is set if it limited this step, or if it grows beyond
+  // it otherwise
+  const ActsScalar accuracy =
+      stepping.stepSize.value(ConstrainedStep::accuracy);
+  if (h == accuracy || std::abs(h * stepSizeScaling) > std::abs(accuracy)) {
+    stepping.stepSize = h * stepSizeScaling;
+  }
+
+  // Propagate the time
+  detail::propagationTime(state, h);
+
+  // When doing error propagation, update the associated Jacobian matrix
+  // The step transport matrix in global coordinates
+  if (stepping.covTransport) {
+    // The state.stepping.jacTransport is only identity after calling the
+    // boundState
+    detail::BlockTransportMatrix D;
+    detail::embeddedTransportMatrix<T>(state, sd, h, D);
+    D.accumulate(stepping.jacTransport);
+  }
+
+  // Update the track parameters to the last stage, which is at the end of
+  // the step, and keep its field for the next step
+  stepping.pos = lastPos;
+  stepping.dir = sd.dir[kStages - 1] / sd.dir[kStages - 1].norm();
+  stepping.lastStagePos = lastPos;
+  stepping.lastStageField = sd.B[kStages - 1];
+  stepping.lastStageValid = true;
+  if (stepping.covTransport) {
+    stepping.derivative.template head<3>() = stepping.dir;
+    stepping.derivative.template segment<3>(4) = sd.k[kStages - 1];
+  }
+  stepping.pathAccumulated += h;
+  return true;
+}
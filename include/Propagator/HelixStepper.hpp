@@ -0,0 +1,108 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "MagneticField/MagneticFieldTraits.hpp"
+#include "Propagator/EigenStepper.hpp"
+#include "Propagator/detail/Helix.hpp"
+#include "Utilities/Definitions.hpp"
+#include "Utilities/Intersection.hpp"
+#include "Utilities/PrecisionPolicy.hpp"
+
+#include <type_traits>
+
+namespace Acts {
+
+/// @brief Stepper along the exact helix of a homogeneous magnetic field
+///
+/// The step and its transport matrix are closed-form, hence a step is never
+/// rejected and its size is not limited by the tolerance. The surface status
+/// refines the straight-line estimate of the path length to the surface
+/// along the helix, so a surface is reached by a single step.
+///
+/// The state, the bound and curvilinear states and the updates are those of
+/// the EigenStepper.
+///
+/// @tparam bfield_t The type of the magnetic field, which must be homogeneous
+/// @tparam precision_policy_t The precision of the covariance transport
+template <typename bfield_t, typename precision_policy_t = DefaultPrecision>
+struct HelixStepper : public EigenStepper<bfield_t, precision_policy_t> {
+  using Base = EigenStepper<bfield_t, precision_policy_t>;
+  using BField = bfield_t;
+  using State = typename Base::State;
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  ACTS_DEVICE_FUNC HelixStepper(BField bField = BField())
+      : Base(std::move(bField)) {}
+
+  /// Perform a step along the helix
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  ///
+  ///                      the state contains the desired step size.
+  ///                      It can be negative during backwards track
+  ///                      propagation.
+  template <typename propagator_state_t>
+  ACTS_DEVICE_FUNC bool step(propagator_state_t &state) const;
+
+#ifdef __CUDACC__
+  /// Perform a step along the helix (supposed to be ran on GPU), by the main
+  /// thread of the block
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  template <typename propagator_state_t>
+  __device__ bool stepOnDevice(propagator_state_t &state) const {
+    if (threadIdx.x == 0 && threadIdx.y == 0) {
+      step(state);
+    }
+    __syncthreads();
+    return true;
+  }
+#endif
+
+  /// Update surface status
+  ///
+  /// It checks the status to the reference surface & updates the step size
+  /// to the path length along the helix
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param surface [in] The surface provided
+  /// @param bcheck [in] The boundary check for this status update
+  template <typename surface_derived_t>
+  ACTS_DEVICE_FUNC Intersection::Status
+  updateSurfaceStatus(State &state, const Surface &surface,
+                      const BoundaryCheck &bcheck) const;
+
+private:
+  /// The path length along the helix to a surface
+  ///
+  /// @param state [in] The stepping state
+  /// @param surface [in] The surface
+  /// @param helix [in] The helix through the current position
+  /// @param pathLength [in] The straight-line estimate of the path length
+  template <typename surface_derived_t>
+  ACTS_DEVICE_FUNC ActsScalar helixPathLength(const State &state,
+                                              const Surface &surface,
+                                              const detail::Helix &helix,
+                                              ActsScalar pathLength) const;
+};
+
+/// @brief The stepper of a magnetic field: the HelixStepper if the field
+/// advertises itself as constant, the EigenStepper otherwise
+template <typename bfield_t, typename precision_policy_t = DefaultPrecision>
+using DefaultStepper = typename std::conditional<
+    detail::is_constant_field<bfield_t>::value,
+    HelixStepper<bfield_t, precision_policy_t>,
+    EigenStepper<bfield_t, precision_policy_t>>::type;
+
+} // namespace Acts
+
+#include "Propagator/HelixStepper.ipp"
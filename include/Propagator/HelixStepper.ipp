@@ -0,0 +1,108 @@
+#include "Propagator/detail/TransportMatrix.hpp"
+
+template <typename B, typename P>
+template <typename propagator_state_t>
+ACTS_DEVICE_FUNC bool
+Acts::HelixStepper<B, P>::step(propagator_state_t &state) const {
+  auto &stepping = state.stepping;
+  // The step is exact, i.e. there is a single trial
+  stepping.nStepTrials = 0;
+  stepping.statistics.stepTrials++;
+
+  const ActsScalar h = stepping.stepSize;
+  const detail::Helix helix(stepping.pos, stepping.dir,
+                            stepping.q / stepping.p,
+                            this->getField(stepping, stepping.pos));
+
+  // Propagate the time
+  detail::propagationTime(state, h);
+
+  // When doing error propagation, update the associated Jacobian matrix
+  // The step transport matrix in global coordinates
+  if (stepping.covTransport) {
+    detail::BlockTransportMatrix D;
+    helix.transportMatrix(h, D);
+    // The dt/d(q/p)
+    D.upper.row(3) << 0., 0., 0.,
+        h * state.options.mass * state.options.mass * stepping.q /
+            (stepping.p * std::hypot(1., state.options.mass / stepping.p));
+    // The q/p is not changed
+    D.lower.row(3) << 0., 0., 0., 1.;
+    D.accumulate(stepping.jacTransport);
+  }
+
+  // Move along the helix
+  stepping.pos = helix.position(h);
+  stepping.dir = helix.direction(h);
+  stepping.dir /= stepping.dir.norm();
+  if (stepping.covTransport) {
+    stepping.derivative.template head<3>() = stepping.dir;
+    stepping.derivative.template segment<3>(4) =
+        helix.kappa * stepping.dir.cross(helix.b);
+  }
+  stepping.pathAccumulated += h;
+  return true;
+}
+
+template <typename B, typename P>
+template <typename surface_derived_t>
+ACTS_DEVICE_FUNC Acts::Intersection::Status
+Acts::HelixStepper<B, P>::updateSurfaceStatus(
+    State &state, const Surface &surface, const BoundaryCheck &bcheck) const {
+  auto sIntersection = surface.intersect<surface_derived_t>(
+      state.geoContext, state.pos, state.navDir * state.dir, bcheck);
+
+  // The intersection is on surface already
+  if (sIntersection.intersection.status == Intersection::Status::onSurface) {
+    // Release navigation step size
+    state.stepSize.release(ConstrainedStep::actor);
+    return Intersection::Status::onSurface;
+  } else if (sIntersection.intersection or sIntersection.alternative) {
+    const detail::Helix helix(state.pos, state.dir, state.q / state.p,
+                              this->getField(state, state.pos));
+    // Path and overstep limit checking
+    ActsScalar pLimit = state.stepSize.value(ConstrainedStep::aborter);
+    ActsScalar oLimit = this->overstepLimit(state);
+    auto checkIntersection = [&](const Intersection &intersection) -> bool {
+      ActsScalar cLimit = helixPathLength<surface_derived_t>(
+          state, surface, helix, intersection.pathLength);
+      bool accept = (cLimit > oLimit and cLimit * cLimit < pLimit * pLimit);
+      if (accept) {
+        this->setStepSize(state, state.navDir * cLimit);
+      }
+      return accept;
+    };
+    // If either of the two intersections are viable return reachable
+    if (checkIntersection(sIntersection.intersection) or
+        (sIntersection.alternative and
+         checkIntersection(sIntersection.alternative))) {
+      return Intersection::Status::reachable;
+    }
+  }
+  return Intersection::Status::unreachable;
+}
+
+template <typename B, typename P>
+template <typename surface_derived_t>
+ACTS_DEVICE_FUNC ActsScalar Acts::HelixStepper<B, P>::helixPathLength(
+    const State &state, const Surface &surface, const detail::Helix &helix,
+    ActsScalar pathLength) const {
+  // Newton iterations: the straight-line intersection from the point on the
+  // helix corrects the path length, exactly to first order for a plane
+  constexpr unsigned int kMaxIterations = 5;
+  for (unsigned int i = 0; i < kMaxIterations; ++i) {
+    const ActsScalar s = state.navDir * pathLength;
+    auto sIntersection = surface.intersect<surface_derived_t>(
+        state.geoContext, helix.position(s),
+        state.navDir * helix.direction(s), false);
+    if (not sIntersection.intersection) {
+      break;
+    }
+    const ActsScalar correction = sIntersection.intersection.pathLength;
+    pathLength += correction;
+    if (std::abs(correction) < s_onSurfaceTolerance) {
+      break;
+    }
+  }
+  return pathLength;
+}
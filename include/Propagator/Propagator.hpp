@@ -13,8 +13,10 @@
 
 #include "EventData/TrackParameters.hpp"
 #include "Propagator/DirectNavigator.hpp"
+#include "Propagator/PropagatorStatistics.hpp"
 #include "Propagator/StandardAborters.hpp"
 #include "Utilities/Definitions.hpp"
+#include "Utilities/Trace.hpp"
 
 #include <Eigen/Core>
 #include <cstdio>
@@ -45,6 +47,9 @@ struct PropagatorResult {
 
   /// Signed distance over which the parameters were propagated
   ActsScalar pathLength = 0.;
+
+  /// The counters of the propagation
+  PropagatorStatistics statistics;
 };
 
 /// @brief Options for propagate() call
@@ -112,12 +117,20 @@ template <typename action_t, typename aborter_t> struct PropagatorOptions {
 
 /// @brief Propagator for particles (optionally in a magnetic field)
 ///
+/// @tparam stepper_t Type of the stepper
+/// @tparam navigator_t Type of the navigator
+/// @tparam trace_t Type of the trace policy recording the propagation steps
+/// (compiles to nothing by default)
 template <typename stepper_t,
-          typename navigator_t = DirectNavigator<PlaneSurface<InfiniteBounds>>>
+          typename navigator_t = DirectNavigator<PlaneSurface<InfiniteBounds>>,
+          typename trace_t = VoidTrace>
 class Propagator final {
 public:
   using Jacobian = BoundMatrix;
 
+  /// Typedef the trace policy
+  using Trace = trace_t;
+
   /// Type of state object used by the propagation implementation
   using StepperState = typename stepper_t::State;
 
@@ -204,6 +217,11 @@ public:
   /// @return stepper reference
   ACTS_DEVICE_FUNC stepper_t &refStepper() { return m_stepper; }
 
+  /// @brief Get a const reference on the underlying stepper
+  ///
+  /// @return stepper reference
+  ACTS_DEVICE_FUNC const stepper_t &getStepper() const { return m_stepper; }
+
 private:
   /// Implementation of propagation algorithm
   stepper_t m_stepper;
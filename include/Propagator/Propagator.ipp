@@ -1,9 +1,9 @@
 #include "Utilities/Profiling.hpp"
 
-template <typename S, typename N>
+template <typename S, typename N, typename T>
 template <typename parameters_t, typename propagator_options_t,
           typename path_aborter_t>
-ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
+ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N, T>::propagate(
     const parameters_t &start, const propagator_options_t &options,
     typename propagator_options_t::action_type::result_type &actorResult)
     const {
@@ -11,9 +11,10 @@ ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
 
   PropagatorResult result;
 
-  int surface_steps = 0;
-  int surface_counts = 0;
-
+  // The step counter on the current surface and the surface counter
+  unsigned int surface_steps = 0;
+  unsigned int surface_counts = 0;
+  T::beginPropagation();
 
   using StateType = State<propagator_options_t>;
   StateType state(start, options);
@@ -42,9 +43,6 @@ ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
 
     for (; result.steps < state.options.maxSteps; ++result.steps) {
       // Perform a propagation step - it takes the propagation state
-
-      printf("surface id: %d\n", surface_counts);
-
       PUSH_RANGE("step", 3);
       // int64_t t0 = clock ();
       bool res = m_stepper.step(state);
@@ -57,19 +55,9 @@ ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
       // result.pathLength += s;
 
       POP_RANGE();
-      // std::cout << "state pos after step:" << state.stepping.pos(0, 0) << ", " << state.stepping.pos(0, 1) << ", " << state.stepping.pos(0, 2) << std::endl; 
-      // printf("state pos after step: (%d, %d, %d)\n", state.stepping.pos(0, 0), state.stepping.pos(0, 1), state.stepping.pos(0, 2));
-      // printf("Surface Id %d:\n", result.steps/2);
       ++surface_steps;
-      printf("step id: %d\n", surface_steps);
-      printf("state pos after step: (%f, %f, %f)\n", state.stepping.pos(0, 0), state.stepping.pos(0, 1), state.stepping.pos(0, 2));
-      printf("state dir after step: (%f, %f, %f)\n", state.stepping.dir(0, 0), state.stepping.dir(0, 1), state.stepping.dir(0, 2));
-      printf("state momentum: %f\n", state.stepping.p);
-      printf("state charge: %d\n", state.stepping.q);
-      printf("state num of stepTrails is: %zu\n", state.stepping.nStepTrials);
-      // std::cout << "state pos after step:" << state.stepping.pos << std::endl;
-      // ++surface_steps;
-    
+      state.stepping.statistics.countStep(surface_counts);
+      T::step(state, surface_counts, surface_steps);
 
       // Post-stepping:
       // navigator status call - action list - aborter list - target call
@@ -79,8 +67,7 @@ ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
 
       auto surface = state.navigation.currentSurface;
       if (surface != nullptr) {
-        // printf("Steps %d; %d; %ld\n", surface_steps, surface_counts, t1-t0);
-        // printf("Steps %d; %d\n", surface_steps, surface_counts);
+        T::surface(surface_counts, surface_steps);
         surface_steps = 0;
         ++surface_counts;
       }
@@ -89,14 +76,17 @@ ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
 
       // printf("state pos after kalman: (%f, %f, %f)\n", state.stepping.pos(0, 0), state.stepping.pos(0, 1), state.stepping.pos(0, 2));
 
-      if (state.options.aborter(state, m_stepper, actorResult) or
-          pathAborter(state, m_stepper)) {
+      const bool aborted =
+          state.options.aborter(state, m_stepper, actorResult) or
+          pathAborter(state, m_stepper);
+
+      POP_RANGE();
+
+      if (aborted) {
         terminatedNormally = true;
         break;
       }
 
-      POP_RANGE();
-
       m_navigator.target(state, m_stepper);
     }
 
@@ -112,6 +102,10 @@ ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
   // Post-stepping call to the action list
   state.options.action(state, m_stepper, actorResult);
 
+  // Fill the propagation counters
+  result.statistics = state.stepping.statistics;
+  result.statistics.surfaces = surface_counts;
+
   /// Convert into return type and fill the result object
   //  auto curvState = m_stepper.curvilinearState(state.stepping);
   // Fill the end parameters
@@ -122,16 +116,16 @@ ACTS_DEVICE_FUNC Acts::PropagatorResult Acts::Propagator<S, N>::propagate(
   //    result.transportJacobian = std::get<Jacobian>(curvState);
   //  }
 
-  POP_RANGE()
+  POP_RANGE();
 
   return result;
 }
 
 #ifdef __CUDACC__
-template <typename S, typename N>
+template <typename S, typename N, typename T>
 template <typename parameters_t, typename propagator_options_t,
           typename path_aborter_t>
-__device__ void Acts::Propagator<S, N>::propagate(
+__device__ void Acts::Propagator<S, N, T>::propagate(
     const parameters_t &start, const propagator_options_t &options,
     typename propagator_options_t::action_type::result_type &actorResult,
     Acts::PropagatorResult &result) const {
@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Utilities/Definitions.hpp"
+
+#include <algorithm>
+
+namespace Acts {
+
+/// @brief Counters of a single propagation
+///
+/// The stepper fills the stepping counters and the propagator the number of
+/// steps spent on the way to each surface. The counters of several
+/// propagations can be summed up with operator+=.
+struct PropagatorStatistics {
+  /// Runge-Kutta trials, i.e. accepted and rejected steps
+  unsigned int stepTrials = 0;
+
+  /// Runge-Kutta trials rejected by the error estimate
+  unsigned int rejectedSteps = 0;
+
+  /// Magnetic field evaluations
+  unsigned int fieldEvaluations = 0;
+
+  /// Covariance transports (to bound or curvilinear parameters)
+  unsigned int covarianceTransports = 0;
+
+  /// The number of surfaces reached
+  unsigned int surfaces = 0;
+
+  /// Accepted steps on the way to each surface (the steps after the last
+  /// surface in the sequence go to the last entry)
+  unsigned int surfaceSteps[s_surfacesSize] = {};
+
+  /// @brief Count an accepted step on the way to the given surface
+  ///
+  /// @param surface The index of the surface in the sequence
+  ACTS_DEVICE_FUNC void countStep(unsigned int surface) {
+    surfaceSteps[surface < s_surfacesSize ? surface : s_surfacesSize - 1]++;
+  }
+
+  /// @return The total number of accepted steps
+  ACTS_DEVICE_FUNC unsigned int steps() const {
+    unsigned int total = 0;
+    for (unsigned int i = 0; i < s_surfacesSize; ++i) {
+      total += surfaceSteps[i];
+    }
+    return total;
+  }
+
+  /// Add the counters of another propagation
+  ACTS_DEVICE_FUNC PropagatorStatistics &
+  operator+=(const PropagatorStatistics &other) {
+    stepTrials += other.stepTrials;
+    rejectedSteps += other.rejectedSteps;
+    fieldEvaluations += other.fieldEvaluations;
+    covarianceTransports += other.covarianceTransports;
+    surfaces += other.surfaces;
+    for (unsigned int i = 0; i < s_surfacesSize; ++i) {
+      surfaceSteps[i] += other.surfaceSteps[i];
+    }
+    return *this;
+  }
+};
+
+/// @brief Aggregation of the propagation counters over a batch of tracks
+struct PropagatorBatchStatistics {
+  /// @brief The largest totals of a single propagation
+  ///
+  /// Each is the maximum over the propagations of one total, i.e. the
+  /// steps are those of the propagation with the most steps and not the sum
+  /// of the largest steps per surface.
+  struct Maxima {
+    unsigned int steps = 0;
+    unsigned int stepTrials = 0;
+    unsigned int rejectedSteps = 0;
+    unsigned int fieldEvaluations = 0;
+    unsigned int covarianceTransports = 0;
+    unsigned int surfaces = 0;
+
+    /// Update with the totals of another propagation or batch
+    void update(const Maxima &other) {
+      steps = std::max(steps, other.steps);
+      stepTrials = std::max(stepTrials, other.stepTrials);
+      rejectedSteps = std::max(rejectedSteps, other.rejectedSteps);
+      fieldEvaluations = std::max(fieldEvaluations, other.fieldEvaluations);
+      covarianceTransports =
+          std::max(covarianceTransports, other.covarianceTransports);
+      surfaces = std::max(surfaces, other.surfaces);
+    }
+  };
+
+  /// The number of propagations
+  unsigned int tracks = 0;
+
+  /// The counters summed over the batch
+  PropagatorStatistics total;
+
+  /// The largest totals of a single propagation in the batch
+  Maxima max;
+
+  /// Add the counters of a single propagation
+  void add(const PropagatorStatistics &stats) {
+    tracks++;
+    total += stats;
+    Maxima single;
+    single.steps = stats.steps();
+    single.stepTrials = stats.stepTrials;
+    single.rejectedSteps = stats.rejectedSteps;
+    single.fieldEvaluations = stats.fieldEvaluations;
+    single.covarianceTransports = stats.covarianceTransports;
+    single.surfaces = stats.surfaces;
+    max.update(single);
+  }
+
+  /// Merge another batch (e.g. of another thread)
+  void merge(const PropagatorBatchStatistics &other) {
+    tracks += other.tracks;
+    total += other.total;
+    max.update(other.max);
+  }
+};
+
+} // namespace Acts
@@ -10,6 +10,7 @@
 
 #include "EventData/TrackParameters.hpp"
 #include "Geometry/GeometryContext.hpp"
+#include "Propagator/detail/TransportMatrix.hpp"
 #include "Surfaces/Surface.hpp"
 #include "Utilities/Definitions.hpp"
 
@@ -118,8 +119,9 @@ ACTS_DEVICE_FUNC FreeToBoundMatrix surfaceDerivative(
   const BoundRowVector sVec = surface.derivativeFactors<surface_derived_t>(
       geoContext, parameters.segment<3>(eFreePos0),
       parameters.segment<3>(eFreeDir0), rframeT, jacobianLocalToGlobal);
-  // 8*6 = 8*1 * 1*6
-  jacobianLocalToGlobal -= derivatives * sVec;
+  // 7*6 = 7*1 * 1*6, as q/p does not change along the path
+  jacobianLocalToGlobal.topRows<eFreeParametersSize - 1>() -=
+      derivatives.head<eFreeParametersSize - 1>() * sVec;
   // Return the jacobian to local
   return jacToLocal;
 }
@@ -149,7 +151,8 @@ ACTS_DEVICE_FUNC const FreeToBoundMatrix surfaceDerivative(
   const BoundRowVector sfactors =
       normVec *
       jacobianLocalToGlobal.template topLeftCorner<3, eBoundParametersSize>();
-  jacobianLocalToGlobal -= derivatives * sfactors;
+  jacobianLocalToGlobal.topRows<eFreeParametersSize - 1>() -=
+      derivatives.head<eFreeParametersSize - 1>() * sfactors;
   // Since the jacobian to local needs to calculated for the bound parameters
   // here, it is convenient to do the same here
   return freeToCurvilinearJacobian(direction);
@@ -242,6 +245,23 @@ reinitializeJacobians(FreeMatrix &transportJacobian, FreeVector &derivatives,
   jacobianLocalToGlobal(6, eTHETA) = -sinTheta;
   jacobianLocalToGlobal(7, eQOP) = 1;
 }
+
+/// @brief Apply the transport J * C * J^T to a covariance matrix
+///
+/// @tparam transport_scalar_t The scalar type of the computation
+///
+/// @param [in, out] covarianceMatrix The covariance matrix
+/// @param [in] jacobian The bound to bound jacobian
+template <typename transport_scalar_t>
+ACTS_DEVICE_FUNC void transportCovariance(BoundSymMatrix &covarianceMatrix,
+                                          const BoundMatrix &jacobian) {
+  using TransportMatrix = ActsMatrix<transport_scalar_t, eBoundParametersSize,
+                                     eBoundParametersSize>;
+  const TransportMatrix J = jacobian.template cast<transport_scalar_t>();
+  covarianceMatrix =
+      (J * covarianceMatrix.template cast<transport_scalar_t>() * J.transpose())
+          .template cast<ActsScalar>();
+}
 } // namespace
 
 /// @brief These functions perform the transport of a covariance matrix using
@@ -266,22 +286,26 @@ namespace detail {
 /// @param [in] surface is the surface to which the covariance is
 ///        forwarded to
 /// @note No check is done if the position is actually on the surface
-template <typename surface_derived_t>
+///
+/// @tparam transport_scalar_t The scalar type of the covariance transport
+template <typename surface_derived_t,
+          typename transport_scalar_t = ActsScalar>
 ACTS_DEVICE_FUNC void
 covarianceTransport(const GeometryContext &geoContext,
                     BoundSymMatrix &covarianceMatrix, BoundMatrix &jacobian,
                     FreeMatrix &transportJacobian, FreeVector &derivatives,
                     BoundToFreeMatrix &jacobianLocalToGlobal,
                     const FreeVector &parameters, const Surface &surface) {
-  // Build the full jacobian (8*8 * 8*6)
-  jacobianLocalToGlobal = transportJacobian * jacobianLocalToGlobal;
+  // Build the full jacobian (8*8 * 8*6), with only the non-trivial blocks
+  // of the transport jacobian
+  transportJacobianProduct(transportJacobian, jacobianLocalToGlobal);
   const FreeToBoundMatrix jacToLocal = surfaceDerivative<surface_derived_t>(
       geoContext, parameters, jacobianLocalToGlobal, derivatives, surface);
   // Bound to bound jacobian
   jacobian = jacToLocal * jacobianLocalToGlobal;
 
   // Apply the actual covariance transport
-  covarianceMatrix = jacobian * covarianceMatrix * jacobian.transpose();
+  transportCovariance<transport_scalar_t>(covarianceMatrix, jacobian);
 
   // Reinitialize jacobian components
   reinitializeJacobians<surface_derived_t>(geoContext, transportJacobian,
@@ -300,19 +324,23 @@ covarianceTransport(const GeometryContext &geoContext,
 /// @param [in, out] jacobianLocalToGlobal Projection jacobian of the last bound
 /// parametrisation to free parameters
 /// @param [in] direction Normalised direction vector
+///
+/// @tparam transport_scalar_t The scalar type of the covariance transport
+template <typename transport_scalar_t = ActsScalar>
 ACTS_DEVICE_FUNC void
 covarianceTransport(BoundSymMatrix &covarianceMatrix, BoundMatrix &jacobian,
                     FreeMatrix &transportJacobian, FreeVector &derivatives,
                     BoundToFreeMatrix &jacobianLocalToGlobal,
                     const Vector3D &direction) {
-  // Build the full jacobian
-  jacobianLocalToGlobal = transportJacobian * jacobianLocalToGlobal;
+  // Build the full jacobian, with only the non-trivial blocks of the
+  // transport jacobian
+  transportJacobianProduct(transportJacobian, jacobianLocalToGlobal);
   const FreeToBoundMatrix jacToLocal =
       surfaceDerivative(direction, jacobianLocalToGlobal, derivatives);
   jacobian = jacToLocal * jacobianLocalToGlobal;
 
   // Apply the actual covariance transport
-  covarianceMatrix = jacobian * covarianceMatrix * jacobian.transpose();
+  transportCovariance<transport_scalar_t>(covarianceMatrix, jacobian);
 
   // Reinitialize jacobian components
   reinitializeJacobians(transportJacobian, derivatives, jacobianLocalToGlobal,
@@ -342,7 +370,10 @@ covarianceTransport(BoundSymMatrix &covarianceMatrix, BoundMatrix &jacobian,
 ///   - the parameters at the surface
 ///   - the stepwise jacobian towards it (from last bound)
 ///   - and the path length (from start - for ordering)
-template <typename surface_derived_t>
+///
+/// @tparam transport_scalar_t The scalar type of the covariance transport
+template <typename surface_derived_t,
+          typename transport_scalar_t = ActsScalar>
 ACTS_DEVICE_FUNC void
 boundState(const GeometryContext &geoContext, BoundSymMatrix &covarianceMatrix,
            BoundMatrix &jacobian, FreeMatrix &transportJacobian,
@@ -354,7 +385,7 @@ boundState(const GeometryContext &geoContext, BoundSymMatrix &covarianceMatrix,
   BoundSymMatrix cov = BoundSymMatrix::Zero();
   if (covTransport) {
     // The jacobian, covarianceMatrix, jacobianLocalToGlobal are updated
-    covarianceTransport<surface_derived_t>(
+    covarianceTransport<surface_derived_t, transport_scalar_t>(
         geoContext, covarianceMatrix, jacobian, transportJacobian, derivatives,
         jacobianLocalToGlobal, parameters, surface);
     cov = covarianceMatrix;
@@ -518,6 +549,9 @@ __device__ void boundStateOnDevice(
 ///   - the curvilinear parameters at given position
 ///   - the stepweise jacobian towards it (from last bound)
 ///   - and the path length (from start - for ordering)
+///
+/// @tparam transport_scalar_t The scalar type of the covariance transport
+template <typename transport_scalar_t = ActsScalar>
 CurvilinearState ACTS_DEVICE_FUNC curvilinearState(
     BoundSymMatrix &covarianceMatrix, BoundMatrix &jacobian,
     FreeMatrix &transportJacobian, FreeVector &derivatives,
@@ -528,8 +562,9 @@ CurvilinearState ACTS_DEVICE_FUNC curvilinearState(
   // Covariance transport
   BoundSymMatrix cov = BoundSymMatrix::Zero();
   if (covTransport) {
-    covarianceTransport(covarianceMatrix, jacobian, transportJacobian,
-                        derivatives, jacobianLocalToGlobal, direction);
+    covarianceTransport<transport_scalar_t>(
+        covarianceMatrix, jacobian, transportJacobian, derivatives,
+        jacobianLocalToGlobal, direction);
     cov = covarianceMatrix;
   }
   // Create the curvilinear parameters
@@ -0,0 +1,148 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Propagator/detail/TransportMatrix.hpp"
+#include "Utilities/Definitions.hpp"
+
+#include <cmath>
+
+namespace Acts {
+namespace detail {
+
+/// @brief The helix of a particle in a homogeneous magnetic field
+///
+/// With the unit field direction b and the transverse curvature
+/// kappa = q/p |B|, the direction T turns around b by the angle
+/// phi = kappa s over the path length s:
+///
+///   T(s) = T + (cos(phi) - 1) T_perp + sin(phi) T x b
+///   r(s) = r + s (T.b) b + sin(phi) / kappa T_perp
+///              + (1 - cos(phi)) / kappa T x b
+///
+/// with the component T_perp = T - (T.b) b transverse to the field. Both are
+/// linear in T, which gives the closed-form transport matrix.
+struct Helix {
+  /// @brief Constructor from the start position and direction
+  ///
+  /// @param pos The start position
+  /// @param dir The start direction
+  /// @param qop The charge over momentum q/p
+  /// @param bField The magnetic field
+  ACTS_DEVICE_FUNC Helix(const Vector3D &pos, const Vector3D &dir,
+                         ActsScalar qop, const Vector3D &bField)
+      : position0(pos), direction0(dir), bNorm(bField.norm()) {
+    // Any direction for a vanishing field, where the helix is a line
+    b = bNorm > 0. ? Vector3D(bField / bNorm) : Vector3D(0., 0., 1.);
+    kappa = qop * bNorm;
+    dirPerp = dir - dir.dot(b) * b;
+    dirCross = dir.cross(b);
+  }
+
+  /// @return The position after the path length s
+  ACTS_DEVICE_FUNC Vector3D position(ActsScalar s) const {
+    const ActsScalar phi = kappa * s;
+    return position0 + s * (direction0 - dirPerp) + s * sinc(phi) * dirPerp +
+           s * cosc(phi) * dirCross;
+  }
+
+  /// @return The direction after the path length s
+  ACTS_DEVICE_FUNC Vector3D direction(ActsScalar s) const {
+    const ActsScalar phi = kappa * s;
+    return direction0 - oneMinusCos(phi) * dirPerp + std::sin(phi) * dirCross;
+  }
+
+  /// @brief The derivatives of the position and direction after the path
+  /// length s w.r.t. the start direction and q/p
+  ///
+  /// @param s The path length
+  /// @param [in, out] D The transport matrix, whose time row is not set
+  ACTS_DEVICE_FUNC void transportMatrix(ActsScalar s,
+                                        BlockTransportMatrix &D) const {
+    const ActsScalar phi = kappa * s;
+    const ActsScalar cosPhi = std::cos(phi);
+    const ActsScalar sinPhi = std::sin(phi);
+    // The matrix X of the cross product with b, i.e. X * v = v x b, and the
+    // projection onto b
+    ActsMatrixD<3, 3> X;
+    X << 0., b.z(), -b.y(), -b.z(), 0., b.x(), b.y(), -b.x(), 0.;
+    const ActsMatrixD<3, 3> bb = b * b.transpose();
+    const ActsScalar S = s * sinc(phi);
+    const ActsScalar C = s * cosc(phi);
+
+    // The dF/dT and dF/dL
+    D.upper.block<3, 3>(0, 0) =
+        S * ActsMatrixD<3, 3>::Identity() + (s - S) * bb + C * X;
+    D.upper.block<3, 1>(0, 3) =
+        s * s * bNorm * (g2(phi) * dirCross - g1(phi) * dirPerp);
+    // The dG/dT and dG/dL
+    D.lower.block<3, 3>(0, 0) = cosPhi * ActsMatrixD<3, 3>::Identity() +
+                                oneMinusCos(phi) * bb + sinPhi * X;
+    D.lower.block<3, 1>(0, 3) =
+        s * bNorm * (cosPhi * dirCross - sinPhi * dirPerp);
+  }
+
+  Vector3D position0;
+  Vector3D direction0;
+  /// The field strength and unit direction
+  ActsScalar bNorm;
+  Vector3D b;
+  /// The transverse curvature q/p |B|
+  ActsScalar kappa;
+  /// The start direction transverse to the field, and its cross product with
+  /// the field direction
+  Vector3D dirPerp;
+  Vector3D dirCross;
+
+  /// The functions of the turning angle phi, with their series for small
+  /// angles where the closed form cancels (or divides by zero)
+
+  /// The angle below which sinc and cosc use their series
+  static constexpr ActsScalar s_smallAngle = 1e-4;
+  /// The angle below which g1 and g2 use their series
+  static constexpr ActsScalar s_seriesAngle = 0.05;
+
+  /// @return sin(phi) / phi
+  ACTS_DEVICE_FUNC static ActsScalar sinc(ActsScalar phi) {
+    return std::abs(phi) < s_smallAngle ? 1. - phi * phi / 6.
+                                        : std::sin(phi) / phi;
+  }
+
+  /// @return 1 - cos(phi)
+  ACTS_DEVICE_FUNC static ActsScalar oneMinusCos(ActsScalar phi) {
+    const ActsScalar sinHalf = std::sin(0.5 * phi);
+    return 2. * sinHalf * sinHalf;
+  }
+
+  /// @return (1 - cos(phi)) / phi
+  ACTS_DEVICE_FUNC static ActsScalar cosc(ActsScalar phi) {
+    return std::abs(phi) < s_smallAngle ? phi * (0.5 - phi * phi / 24.)
+                                        : oneMinusCos(phi) / phi;
+  }
+
+  /// @return (sin(phi) - phi cos(phi)) / phi^2
+  ACTS_DEVICE_FUNC static ActsScalar g1(ActsScalar phi) {
+    const ActsScalar phi2 = phi * phi;
+    return std::abs(phi) < s_seriesAngle
+               ? phi * (1. / 3. -
+                        phi2 * (1. / 30. - phi2 * (1. / 840. - phi2 / 45360.)))
+               : (std::sin(phi) - phi * std::cos(phi)) / phi2;
+  }
+
+  /// @return (phi sin(phi) - (1 - cos(phi))) / phi^2
+  ACTS_DEVICE_FUNC static ActsScalar g2(ActsScalar phi) {
+    const ActsScalar phi2 = phi * phi;
+    return std::abs(phi) < s_seriesAngle
+               ? 0.5 - phi2 * (1. / 8. - phi2 * (1. / 144. - phi2 / 5760.))
+               : (phi * std::sin(phi) - oneMinusCos(phi)) / phi2;
+  }
+};
+
+} // namespace detail
+} // namespace Acts
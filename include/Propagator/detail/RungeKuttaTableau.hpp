@@ -0,0 +1,111 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Utilities/Definitions.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// @brief Butcher tableau of the Bogacki-Shampine 3(2) embedded pair
+///
+/// Four stages, of which the last one is evaluated at the end of the step
+/// (first same as last), i.e. three field evaluations per accepted step. The
+/// step is of order 3, the error estimate of order 2.
+struct BogackiShampine32 {
+  /// The number of stages
+  static constexpr int kStages = 4;
+  /// The order of the error estimate plus one, i.e. the error scales with
+  /// h^kErrorOrder
+  static constexpr int kErrorOrder = 3;
+
+  /// @return The coefficient a(i,j) of stage j in stage i, for j < i
+  ACTS_DEVICE_FUNC static constexpr ActsScalar a(int i, int j) {
+    constexpr ActsScalar A[kStages][kStages] = {
+        {0., 0., 0., 0.},
+        {1. / 2., 0., 0., 0.},
+        {0., 3. / 4., 0., 0.},
+        {2. / 9., 1. / 3., 4. / 9., 0.}};
+    return A[i][j];
+  }
+
+  /// @return The weight of stage i in the step
+  ACTS_DEVICE_FUNC static constexpr ActsScalar b(int i) {
+    constexpr ActsScalar B[kStages] = {2. / 9., 1. / 3., 4. / 9., 0.};
+    return B[i];
+  }
+
+  /// @return The weight of stage i in the error estimate, i.e. the
+  /// difference of the weights of the two orders
+  ACTS_DEVICE_FUNC static constexpr ActsScalar e(int i) {
+    constexpr ActsScalar E[kStages] = {-5. / 72., 1. / 12., 1. / 9., -1. / 8.};
+    return E[i];
+  }
+};
+
+/// @brief Butcher tableau of the Dormand-Prince 5(4) embedded pair
+///
+/// Seven stages, of which the last one is evaluated at the end of the step
+/// (first same as last), i.e. six field evaluations per accepted step. The
+/// step is of order 5, the error estimate of order 4.
+struct DormandPrince54 {
+  /// The number of stages
+  static constexpr int kStages = 7;
+  /// The order of the error estimate plus one, i.e. the error scales with
+  /// h^kErrorOrder
+  static constexpr int kErrorOrder = 5;
+
+  /// @return The coefficient a(i,j) of stage j in stage i, for j < i
+  ACTS_DEVICE_FUNC static constexpr ActsScalar a(int i, int j) {
+    constexpr ActsScalar A[kStages][kStages] = {
+        {0., 0., 0., 0., 0., 0., 0.},
+        {1. / 5., 0., 0., 0., 0., 0., 0.},
+        {3. / 40., 9. / 40., 0., 0., 0., 0., 0.},
+        {44. / 45., -56. / 15., 32. / 9., 0., 0., 0., 0.},
+        {19372. / 6561., -25360. / 2187., 64448. / 6561., -212. / 729., 0., 0.,
+         0.},
+        {9017. / 3168., -355. / 33., 46732. / 5247., 49. / 176.,
+         -5103. / 18656., 0., 0.},
+        {35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784.,
+         11. / 84., 0.}};
+    return A[i][j];
+  }
+
+  /// @return The weight of stage i in the step
+  ACTS_DEVICE_FUNC static constexpr ActsScalar b(int i) {
+    constexpr ActsScalar B[kStages] = {
+        35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784., 11. / 84.,
+        0.};
+    return B[i];
+  }
+
+  /// @return The weight of stage i in the error estimate, i.e. the
+  /// difference of the weights of the two orders
+  ACTS_DEVICE_FUNC static constexpr ActsScalar e(int i) {
+    constexpr ActsScalar E[kStages] = {
+        71. / 57600.,      0.,         -71. / 16695., 71. / 1920.,
+        -17253. / 339200., 22. / 525., -1. / 40.};
+    return E[i];
+  }
+};
+
+/// @brief Whether the last stage of a tableau is at the end of the step, i.e.
+/// its field can be reused by the first stage of the next step
+template <typename tableau_t> constexpr bool isFirstSameAsLast() {
+  constexpr int last = tableau_t::kStages - 1;
+  for (int j = 0; j < last; ++j) {
+    if (tableau_t::a(last, j) != tableau_t::b(j)) {
+      return false;
+    }
+  }
+  return tableau_t::b(last) == 0.;
+}
+
+} // namespace detail
+} // namespace Acts
@@ -0,0 +1,82 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Utilities/Definitions.hpp"
+#include "Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// @brief The transport matrix D of a step, stored by its non-trivial blocks
+///
+/// A step does not depend on the start position and time, so in blocks of
+/// the position and time (the first four free parameters) and of the
+/// direction and q/p (the last four), D reads
+///
+///   D = | 1  U |
+///       | 0  L |
+///
+/// with the derivatives U of the position and time and L of the direction
+/// and q/p w.r.t. the direction and q/p. The last row of L is (0, 0, 0, 1)
+/// and the time row of U is (0, 0, 0, dt/d(q/p)).
+///
+/// The transport jacobian accumulated from the identity by the steps keeps
+/// this structure, so its product with D only touches the last four columns:
+///
+///   D * | 1  R | = | 1  R + U * S |
+///       | 0  S |   | 0  L * S     |
+struct BlockTransportMatrix {
+  using Block = ActsMatrixD<4, 4>;
+
+  /// The derivatives of the position and time
+  Block upper;
+  /// The derivatives of the direction and q/p
+  Block lower;
+
+  /// @return The dense transport matrix
+  ACTS_DEVICE_FUNC FreeMatrix dense() const {
+    FreeMatrix D = FreeMatrix::Identity();
+    D.topRightCorner<4, 4>() = upper;
+    D.bottomRightCorner<4, 4>() = lower;
+    return D;
+  }
+
+  /// @brief Accumulate the step into a transport jacobian, i.e. J = D * J
+  ///
+  /// @param [in, out] transportJacobian The transport jacobian J since the
+  /// last reset, with the block structure of D
+  ACTS_DEVICE_FUNC void accumulate(FreeMatrix &transportJacobian) const {
+    const Block S = transportJacobian.bottomRightCorner<4, 4>();
+    transportJacobian.topRightCorner<4, 4>().noalias() += upper * S;
+    transportJacobian.bottomRightCorner<4, 4>().noalias() = lower * S;
+  }
+};
+
+/// @brief The product J * M of a transport jacobian J with the block
+/// structure of the BlockTransportMatrix and a matrix M of free rows, e.g.
+/// the jacobian from the bound start parameters
+///
+/// @param [in] transportJacobian The transport jacobian J
+/// @param [in, out] matrix The matrix M, replaced by the product
+template <typename matrix_t>
+ACTS_DEVICE_FUNC void
+transportJacobianProduct(const FreeMatrix &transportJacobian,
+                         matrix_t &matrix) {
+  using Rows = ActsMatrix<typename matrix_t::Scalar, 4,
+                          matrix_t::ColsAtCompileTime>;
+  const Rows lowerRows = matrix.template bottomRows<4>();
+  matrix.template topRows<4>().noalias() +=
+      transportJacobian.topRightCorner<4, 4>() * lowerRows;
+  matrix.template bottomRows<4>().noalias() =
+      transportJacobian.bottomRightCorner<4, 4>() * lowerRows;
+}
+
+} // namespace detail
+} // namespace Acts
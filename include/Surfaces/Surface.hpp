@@ -138,6 +138,23 @@ public:
   ACTS_DEVICE_FUNC const Transform3D &
   transform(const GeometryContext &gctx) const;
 
+  /// Build the cache of the frame of the surface, i.e. the inverse of the
+  /// transform used by the global to local transformations
+  ///
+  /// @note The cache is optional and to be built once the surface is placed,
+  /// e.g. at the construction of the geometry
+  ACTS_DEVICE_FUNC void cacheFrame();
+
+  /// Transform a global position into the local 3D frame of the surface
+  /// using the frame cache if it is built
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position The global position
+  ///
+  /// @return the position in the local 3D frame
+  ACTS_DEVICE_FUNC Vector3D toLocalFrame(const GeometryContext &gctx,
+                                         const Vector3D &position) const;
+
   /// Return method for the surface center by reference
   /// @note the center is always recalculated in order to not keep a cache
   ///
@@ -368,6 +385,12 @@ protected:
 
   /// Possibility to attach a material descrption
   HomogeneousSurfaceMaterial m_surfaceMaterial;
+
+  /// The cached inverse of the transform (see cacheFrame())
+  Transform3D m_inverseTransform = Transform3D::Identity();
+
+  /// Whether the frame cache is built
+  bool m_frameCached = false;
 };
 
 #include "Surfaces/detail/Surface.ipp"
@@ -207,7 +207,7 @@ inline bool LineSurface::globalToLocal(const GeometryContext &gctx,
   const auto &tMatrix = sTransform.matrix();
   Vector3D lineDirection(tMatrix(0, 2), tMatrix(1, 2), tMatrix(2, 2));
   // Bring the global position into the local frame
-  Vector3D loc3Dframe = sTransform.inverse() * position;
+  Vector3D loc3Dframe = toLocalFrame(gctx, position);
   // construct localPosition with sign*perp(candidate) and z.()
   lposition = Vector2D(perp(loc3Dframe), loc3Dframe.z());
   Vector3D sCenter(tMatrix(0, 3), tMatrix(1, 3), tMatrix(2, 3));
@@ -217,7 +217,7 @@ inline bool PlaneSurface<surface_bounds_t>::globalToLocal(
     const GeometryContext &gctx, const Vector3D &position,
     const Vector3D & /*gmom*/, Acts::Vector2D &lposition) const {
   /// the chance that there is no transform is almost 0, let's apply it
-  Vector3D loc3Dframe = (transform(gctx).inverse()) * position;
+  Vector3D loc3Dframe = toLocalFrame(gctx, position);
   lposition = Vector2D(loc3Dframe.x(), loc3Dframe.y());
   return ((loc3Dframe.z() * loc3Dframe.z() >
            s_onSurfaceTolerance * s_onSurfaceTolerance)
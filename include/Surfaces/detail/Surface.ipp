@@ -11,7 +11,9 @@ inline Surface::Surface(const Transform3D &tform)
 
 inline Surface::Surface(const Surface &other)
     : GeometryObject(other), m_transform(other.m_transform),
-      m_surfaceMaterial(other.m_surfaceMaterial) {}
+      m_surfaceMaterial(other.m_surfaceMaterial),
+      m_inverseTransform(other.m_inverseTransform),
+      m_frameCached(other.m_frameCached) {}
 
 inline Surface::Surface(const GeometryContext &gctx, const Surface &other,
                         const Transform3D &shift)
@@ -54,6 +56,8 @@ inline Surface &Surface::operator=(const Surface &other) {
     GeometryObject::operator=(other);
     m_surfaceMaterial = other.m_surfaceMaterial;
     m_transform = other.m_transform;
+    m_inverseTransform = other.m_inverseTransform;
+    m_frameCached = other.m_frameCached;
   }
   return *this;
 }
@@ -87,6 +91,20 @@ inline bool Surface::operator!=(const Surface &sf) const {
   return !(operator==(sf));
 }
 
+inline void Surface::cacheFrame() {
+  m_inverseTransform = m_transform.inverse();
+  m_frameCached = true;
+}
+
+inline Vector3D Surface::toLocalFrame(const GeometryContext &gctx,
+                                      const Vector3D &position) const {
+  // @note The cached inverse gives the identical result
+  if (m_frameCached) {
+    return m_inverseTransform * position;
+  }
+  return transform(gctx).inverse() * position;
+}
+
 inline const Vector3D Surface::center(const GeometryContext &gctx) const {
   // fast access via tranform matrix (and not translation())
   auto tMatrix = m_transform.matrix();
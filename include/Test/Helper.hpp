@@ -15,6 +15,9 @@ namespace Test {
 
 // Struct for B field
 struct ConstantBField {
+  // The field is homogeneous, i.e. the tracks are helices
+  static constexpr bool isConstant = true;
+
   ACTS_DEVICE_FUNC static Acts::Vector3D
   getField(const Acts::Vector3D & /*field*/) {
     return Acts::Vector3D(0., 0., 2. * Acts::units::_T);
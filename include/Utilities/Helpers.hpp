@@ -387,7 +387,7 @@ auto matrixToBitset(const Eigen::PlainObjectBase<Derived> &m) {
 template <typename S>
 ACTS_DEVICE_FUNC ActsMatrix<S, 2, 2>
 get2DMatrixInverse(const ActsMatrix<S, 2, 2> &cov) {
-  ActsScalar det = cov(0, 0) * cov(1, 1) - cov(0, 1) * cov(1, 0);
+  S det = cov(0, 0) * cov(1, 1) - cov(0, 1) * cov(1, 0);
   ActsMatrix<S, 2, 2> inverse = ActsMatrix<S, 2, 2>::Zero();
 
   inverse(0, 0) = cov(1, 1) / det;
@@ -70,9 +70,10 @@ template <typename T> ACTS_DEVICE_FUNC T determinant(T *m, int size) {
 }
 
 // T is the data type of the computations (default is double)
-// P is the data type of the input/output matrices (aka ActsScalar)
-template <typename T, typename P>
-ACTS_DEVICE_FUNC void invert(const ActsMatrixX<P> *em, ActsMatrixX<P> *result) {
+// matrix_t is the type of the input/output matrices
+template <typename T, typename matrix_t>
+ACTS_DEVICE_FUNC void invert(const matrix_t *em, matrix_t *result) {
+  using P = typename matrix_t::Scalar;
   // make sure the matrix is square
   assert(em->rows() == em->cols());
   const int size = em->rows();
@@ -100,12 +101,14 @@ ACTS_DEVICE_FUNC void invert(const ActsMatrixX<P> *em, ActsMatrixX<P> *result) {
     }
 }
 
+// @note The dynamic matrices are allocated on the heap, use the fixed-size
+// version below in the hot path
 template <typename P, typename T = double>
 ACTS_DEVICE_FUNC ActsMatrixX<P> calculateInverse(ActsMatrixX<P> m) {
 #ifdef __CUDA_ARCH__
   // printf("CustomerInverter in usage");
   ActsMatrixX<P> result(m.rows(), m.cols());
-  invert<T, P>(&m, &result);
+  invert<T>(&m, &result);
   return result;
 #else
   // std::cout << "EigenInverter in usage" << std::endl;
@@ -113,4 +116,18 @@ ACTS_DEVICE_FUNC ActsMatrixX<P> calculateInverse(ActsMatrixX<P> m) {
 #endif
 }
 
+// The inverse of a fixed-size matrix, which does not allocate
+template <typename P, typename T = double, int N>
+ACTS_DEVICE_FUNC Eigen::Matrix<P, N, N>
+calculateInverse(const Eigen::Matrix<P, N, N> &m) {
+  static_assert(N <= MAX, "The matrix is too large for the inversion");
+#ifdef __CUDA_ARCH__
+  Eigen::Matrix<P, N, N> result;
+  invert<T>(&m, &result);
+  return result;
+#else
+  return m.inverse();
+#endif
+}
+
 } // namespace Acts
@@ -0,0 +1,81 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+
+/// @brief Symmetric matrix storing only the N * (N + 1) / 2 elements of the
+/// upper triangle
+///
+/// The elements are packed row by row, i.e. (0,0), (0,1), ..., (0,N-1),
+/// (1,1), ..., (N-1,N-1). The matrix is trivially copyable, so that arrays of
+/// it can be copied to the device or written to a file as they are.
+///
+/// @tparam T The scalar type
+/// @tparam N The size of the matrix
+template <typename T, int N> class PackedSymMatrix {
+public:
+  using Scalar = T;
+  using Matrix = Eigen::Matrix<T, N, N>;
+
+  /// The number of stored elements
+  static constexpr int kSize = N * (N + 1) / 2;
+
+  /// @note The elements are not initialized (like for Eigen matrices)
+  PackedSymMatrix() = default;
+
+  /// @brief Constructor from the upper triangle of an Eigen matrix
+  ///
+  /// @param m The symmetric matrix
+  template <typename derived_t>
+  ACTS_DEVICE_FUNC explicit PackedSymMatrix(
+      const Eigen::MatrixBase<derived_t> &m) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = i; j < N; ++j) {
+        m_data[index(i, j)] = m(i, j);
+      }
+    }
+  }
+
+  /// @return The position of the element (i,j) in the packed storage
+  static ACTS_DEVICE_FUNC constexpr int index(int i, int j) {
+    return i <= j ? i * (2 * N - i - 1) / 2 + j : j * (2 * N - j - 1) / 2 + i;
+  }
+
+  ACTS_DEVICE_FUNC T operator()(int i, int j) const {
+    return m_data[index(i, j)];
+  }
+  ACTS_DEVICE_FUNC T &operator()(int i, int j) { return m_data[index(i, j)]; }
+
+  ACTS_DEVICE_FUNC const T *data() const { return m_data; }
+  ACTS_DEVICE_FUNC T *data() { return m_data; }
+
+  /// @return The full symmetric matrix
+  ACTS_DEVICE_FUNC Matrix toMatrix() const {
+    Matrix m;
+    for (int i = 0; i < N; ++i) {
+      m(i, i) = m_data[index(i, i)];
+      for (int j = i + 1; j < N; ++j) {
+        m(i, j) = m(j, i) = m_data[index(i, j)];
+      }
+    }
+    return m;
+  }
+
+private:
+  T m_data[kSize];
+};
+
+/// The packed covariance of the bound parameters
+using BoundPackedSymMatrix =
+    PackedSymMatrix<BoundParametersScalar, eBoundParametersSize>;
+
+} // namespace Acts
@@ -0,0 +1,40 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Utilities/Definitions.hpp"
+
+namespace Acts {
+
+/// @brief Precision of the computations of the fit components
+///
+/// The track parameters, the stepper state and the stored track states keep
+/// the storage type ActsScalar. The policy only selects the scalar type the
+/// components compute in, i.e. they cast their inputs to it and the results
+/// back to ActsScalar. This allows e.g. to propagate and store in float, but
+/// to update and smooth the covariance in double.
+///
+/// @tparam transport_scalar_t The scalar type of the covariance transport
+/// @tparam update_scalar_t The scalar type of the Kalman update and smoothing
+template <typename transport_scalar_t, typename update_scalar_t>
+struct PrecisionPolicy {
+  using TransportScalar = transport_scalar_t;
+  using UpdateScalar = update_scalar_t;
+};
+
+/// Everything is computed in the storage precision
+using DefaultPrecision = PrecisionPolicy<ActsScalar, ActsScalar>;
+
+/// The covariance update and smoothing are computed in double precision
+using MixedPrecision = PrecisionPolicy<ActsScalar, double>;
+
+/// All the covariance computations are done in double precision
+using DoublePrecision = PrecisionPolicy<double, double>;
+
+} // namespace Acts
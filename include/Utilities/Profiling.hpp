@@ -1,7 +1,13 @@
 #ifndef UTILITIES_HPP_ACTS
 #define UTILITIES_HPP_ACTS
 
-#if 0
+// The range instrumentation backend is selected at compile time:
+// - ACTS_NVTX: NVTX ranges for Nsight Systems
+// - ACTS_CPU_PROFILING: host-side TSC timers (see detail/Profiler.hpp),
+//   not available in device code
+// - otherwise the macros compile to nothing
+
+#if defined(ACTS_NVTX)
 
 #include <nvtx3/nvToolsExt.h>
 
@@ -25,6 +31,20 @@ const int      num_colors { sizeof( colors ) / sizeof( uint32_t ) };
 
 #define POP_RANGE() nvtxRangePop();
 
+#elif defined(ACTS_CPU_PROFILING) && !defined(__CUDA_ARCH__)
+
+#include "Utilities/detail/Profiler.hpp"
+
+// @note The range id is looked up once per call site
+#define PUSH_RANGE(name, cid)                                                  \
+  do {                                                                         \
+    static const unsigned int acts_range_id =                                  \
+        Acts::detail::Profiler::rangeId(name);                                 \
+    Acts::detail::Profiler::push(acts_range_id);                               \
+  } while (0)
+
+#define POP_RANGE() Acts::detail::Profiler::pop()
+
 #else
 
 #define PUSH_RANGE(a, b)                                                       \
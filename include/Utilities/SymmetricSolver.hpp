@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Utilities/Definitions.hpp"
+
+#include <limits>
+
+namespace Acts {
+
+/// @brief LDL^T decomposition of a fixed-size symmetric positive definite
+/// matrix
+///
+/// The decomposition A = L * D * L^T is done in place on the stack without
+/// square roots, so that it can be used in host and device code. It is used
+/// to solve A * X = B for X instead of computing the inverse of A.
+///
+/// The decomposition fails if a pivot D_j is not larger than tolerance * A_jj.
+/// The ratio D_j / A_jj is the fraction of the variance of parameter j not
+/// explained by the previous parameters, i.e. it does not depend on the units
+/// of the parameters. A failure means that A is not positive definite or too
+/// badly conditioned to be solved at the given precision.
+///
+/// @tparam T The scalar type
+/// @tparam N The size of the matrix
+template <typename T, int N> class SymmetricLDLT {
+public:
+  using Matrix = Eigen::Matrix<T, N, N>;
+
+  /// The default tolerance of the pivots relative to the diagonal
+  static constexpr T s_defaultTolerance =
+      N * std::numeric_limits<T>::epsilon();
+
+  /// @brief Decompose the matrix
+  ///
+  /// @param A The symmetric matrix (only the lower triangle is used)
+  /// @param tolerance The minimum relative pivot
+  ACTS_DEVICE_FUNC explicit SymmetricLDLT(const Matrix &A,
+                                          T tolerance = s_defaultTolerance) {
+    for (int j = 0; j < N; ++j) {
+      T d = A(j, j);
+      for (int k = 0; k < j; ++k) {
+        d -= m_L(j, k) * m_L(j, k) * m_D[k];
+      }
+      // @note The negated comparisons catch NaN as well
+      const T pivotRatio = d / A(j, j);
+      if (not(A(j, j) > 0) or not(pivotRatio > tolerance)) {
+        m_success = false;
+        m_failedPivot = j;
+        m_minPivotRatio = pivotRatio;
+        return;
+      }
+      if (pivotRatio < m_minPivotRatio) {
+        m_minPivotRatio = pivotRatio;
+      }
+      m_D[j] = d;
+      for (int i = j + 1; i < N; ++i) {
+        T s = A(i, j);
+        for (int k = 0; k < j; ++k) {
+          s -= m_L(i, k) * m_L(j, k) * m_D[k];
+        }
+        m_L(i, j) = s / d;
+      }
+    }
+  }
+
+  /// @return Whether the decomposition succeeded
+  ACTS_DEVICE_FUNC bool success() const { return m_success; }
+
+  /// @return The index of the failed pivot (-1 if succeeded)
+  ACTS_DEVICE_FUNC int failedPivot() const { return m_failedPivot; }
+
+  /// @return The smallest relative pivot D_j / A_jj, i.e. a measure of the
+  /// conditioning of the matrix (the failed one if not succeeded)
+  ACTS_DEVICE_FUNC T minPivotRatio() const { return m_minPivotRatio; }
+
+  /// @brief Solve A * X = B
+  ///
+  /// @tparam M The number of right-hand side columns
+  /// @param B The right-hand side
+  ///
+  /// @pre The decomposition must have succeeded
+  template <int M>
+  ACTS_DEVICE_FUNC Eigen::Matrix<T, N, M>
+  solve(const Eigen::Matrix<T, N, M> &B) const {
+    Eigen::Matrix<T, N, M> X = B;
+    for (int c = 0; c < M; ++c) {
+      // Forward substitution L * y = b
+      for (int i = 1; i < N; ++i) {
+        for (int k = 0; k < i; ++k) {
+          X(i, c) -= m_L(i, k) * X(k, c);
+        }
+      }
+      // D * z = y
+      for (int i = 0; i < N; ++i) {
+        X(i, c) /= m_D[i];
+      }
+      // Backward substitution L^T * x = z
+      for (int i = N - 2; i >= 0; --i) {
+        for (int k = i + 1; k < N; ++k) {
+          X(i, c) -= m_L(k, i) * X(k, c);
+        }
+      }
+    }
+    return X;
+  }
+
+private:
+  /// The strictly lower triangle of the unit lower triangular factor
+  Matrix m_L = Matrix::Zero();
+
+  /// The pivots
+  T m_D[N] = {};
+
+  bool m_success = true;
+  int m_failedPivot = -1;
+  T m_minPivotRatio = 1;
+};
+
+} // namespace Acts
@@ -0,0 +1,214 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Utilities/Definitions.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace Acts {
+
+/// @brief A single trace record
+///
+/// The meaning of the payload depends on the event type:
+/// - eStep: position(3), direction(3), momentum, charge
+/// - eSurface: none
+/// - eFittedState: smoothed bound parameters(6)
+/// - eJacobianRow: one row of the bound transport jacobian(6)
+struct TraceEvent {
+  enum Type : uint8_t {
+    ePropagation = 0,
+    eStep = 1,
+    eSurface = 2,
+    eFittedState = 3,
+    eJacobianRow = 4
+  };
+
+  Type type = ePropagation;
+  /// The surface counter (or the fitted state index)
+  uint32_t surface = 0;
+  /// The step counter on the surface (or the jacobian row)
+  uint32_t step = 0;
+  /// The number of Runge-Kutta trials of the step
+  uint32_t trials = 0;
+  /// The payload
+  ActsScalar values[8] = {};
+};
+
+/// @brief The default trace policy which compiles to nothing
+struct VoidTrace {
+  static constexpr bool enabled = false;
+
+  ACTS_DEVICE_FUNC static void beginPropagation() {}
+
+  template <typename propagator_state_t>
+  ACTS_DEVICE_FUNC static void step(const propagator_state_t & /*state*/,
+                                    unsigned int /*surface*/,
+                                    unsigned int /*step*/) {}
+
+  ACTS_DEVICE_FUNC static void surface(unsigned int /*surface*/,
+                                       unsigned int /*steps*/) {}
+
+  template <typename track_state_t>
+  ACTS_DEVICE_FUNC static void fittedState(unsigned int /*index*/,
+                                           const track_state_t & /*ts*/) {}
+
+  static void dump(std::ostream & /*os*/) {}
+
+  static void clear() {}
+};
+
+/// @brief A trace policy recording the events into a per-thread ring buffer
+///
+/// Every thread writes into its own buffer without any locking, the oldest
+/// events are overwritten once the capacity is reached. The buffers are kept
+/// alive after the threads exit and can be dumped after the run.
+///
+/// @tparam capacity The number of events kept per thread (power of 2)
+///
+/// @note This is a host only policy
+template <unsigned int capacity = (1u << 16)> class RingBufferTrace {
+  static_assert((capacity & (capacity - 1)) == 0,
+                "The ring buffer capacity must be a power of 2");
+
+public:
+  static constexpr bool enabled = true;
+
+  /// The ring buffer of one thread
+  struct Buffer {
+    /// The number of events written so far
+    std::atomic<uint64_t> head{0};
+    /// The registration order of the owning thread
+    unsigned int thread = 0;
+    /// The events
+    std::vector<TraceEvent> events = std::vector<TraceEvent>(capacity);
+
+    void push(const TraceEvent &event) {
+      uint64_t h = head.load(std::memory_order_relaxed);
+      events[h & (capacity - 1)] = event;
+      head.store(h + 1, std::memory_order_release);
+    }
+  };
+
+  static void beginPropagation() {
+    TraceEvent event;
+    event.type = TraceEvent::ePropagation;
+    local().push(event);
+  }
+
+  template <typename propagator_state_t>
+  static void step(const propagator_state_t &state, unsigned int surface,
+                   unsigned int step) {
+    const auto &stepping = state.stepping;
+    TraceEvent event;
+    event.type = TraceEvent::eStep;
+    event.surface = surface;
+    event.step = step;
+    event.trials = stepping.nStepTrials;
+    for (unsigned int i = 0; i < 3; ++i) {
+      event.values[i] = stepping.pos(i);
+      event.values[3 + i] = stepping.dir(i);
+    }
+    event.values[6] = stepping.p;
+    event.values[7] = stepping.q;
+    local().push(event);
+  }
+
+  static void surface(unsigned int surface, unsigned int steps) {
+    TraceEvent event;
+    event.type = TraceEvent::eSurface;
+    event.surface = surface;
+    event.step = steps;
+    local().push(event);
+  }
+
+  template <typename track_state_t>
+  static void fittedState(unsigned int index, const track_state_t &ts) {
+    TraceEvent event;
+    event.type = TraceEvent::eFittedState;
+    event.surface = index;
+    const auto &pars = ts.parameter.smoothed.parameters();
+    for (unsigned int i = 0; i < eBoundParametersSize; ++i) {
+      event.values[i] = pars(i);
+    }
+    local().push(event);
+    const auto &jac = ts.parameter.jacobian;
+    for (unsigned int row = 0; row < eBoundParametersSize; ++row) {
+      TraceEvent rowEvent;
+      rowEvent.type = TraceEvent::eJacobianRow;
+      rowEvent.surface = index;
+      rowEvent.step = row;
+      for (unsigned int i = 0; i < eBoundParametersSize; ++i) {
+        rowEvent.values[i] = jac(row, i);
+      }
+      local().push(rowEvent);
+    }
+  }
+
+  /// @brief Dump the recorded events of all threads
+  ///
+  /// @note Must not run concurrently to the recording threads
+  static void dump(std::ostream &os) {
+    static const char *names[] = {"propagation", "step", "surface",
+                                  "fitted_state", "jacobian_row"};
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    os << "thread,event,surface,step,trials,v0,v1,v2,v3,v4,v5,v6,v7\n";
+    for (const auto &buffer : registry().buffers) {
+      uint64_t end = buffer->head.load(std::memory_order_acquire);
+      uint64_t begin = end > capacity ? end - capacity : 0;
+      for (uint64_t i = begin; i < end; ++i) {
+        const auto &event = buffer->events[i & (capacity - 1)];
+        os << buffer->thread << "," << names[event.type] << ","
+           << event.surface << "," << event.step << "," << event.trials;
+        for (const auto &value : event.values) {
+          os << "," << value;
+        }
+        os << "\n";
+      }
+    }
+  }
+
+  /// @brief Drop all recorded events
+  static void clear() {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    for (auto &buffer : registry().buffers) {
+      buffer->head.store(0, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+  };
+
+  static Registry &registry() {
+    static Registry s_registry;
+    return s_registry;
+  }
+
+  // The buffer of the calling thread, registered on first use
+  static Buffer &local() {
+    thread_local std::shared_ptr<Buffer> t_buffer = [] {
+      auto buffer = std::make_shared<Buffer>();
+      std::lock_guard<std::mutex> lock(registry().mutex);
+      buffer->thread = registry().buffers.size();
+      registry().buffers.push_back(buffer);
+      return buffer;
+    }();
+    return *t_buffer;
+  }
+};
+
+} // namespace Acts
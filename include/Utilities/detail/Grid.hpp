@@ -5,7 +5,10 @@
 #include "Utilities/IAxis.hpp"
 #include "Utilities/Interpolation.hpp"
 #include "Utilities/detail/grid_helper.hpp"
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <set>
@@ -17,6 +20,19 @@ namespace Acts {
 
 namespace detail {
 
+/// @brief Reference-counted owner of the values of a grid
+///
+/// The storage is shared by all copies of a grid and released with the last
+/// one, e.g. the values are deleted or a memory-mapped file is unmapped.
+///
+/// @tparam T type of values stored inside the bins of the grid
+template <typename T> struct GridStorage {
+  /// The number of grids sharing the values
+  std::atomic<size_t> refCount{1};
+  /// The release of the values
+  std::function<void(T *)> release;
+};
+
 /// @brief class for describing a regular multi-dimensional grid
 ///
 /// @tparam T    type of values stored inside the bins of the grid
@@ -27,6 +43,12 @@ namespace detail {
 /// either by global bin index, local bin indices or position.
 ///
 /// @note @c T must be default-constructible.
+///
+/// The values are held in a reference-counted storage, i.e. copying a grid is
+/// O(1) and all copies read the same values. A copy detaches from the shared
+/// values (copy-on-write) when it is accessed through a non-const accessor.
+/// The sharing is only done on the host, a copy on the device refers to the
+/// same values without owning them.
 template <typename T, class... Axes> class Grid final {
 public:
   /// number of dimensions of the grid
@@ -48,29 +70,93 @@ public:
   /// @param [in] axes actual axis objects spanning the grid
   ACTS_DEVICE_FUNC Grid(std::tuple<Axes...> axes) : m_axes(std::move(axes)) {
     m_values = new T[size()];
+#ifndef __CUDA_ARCH__
+    m_storage = new GridStorage<T>();
+    m_storage->release = [](T *values) { delete[] values; };
+#endif
+  }
+
+  /// @brief Constructor with values owned elsewhere, e.g. a memory-mapped
+  /// file
+  ///
+  /// @param [in] axes actual axis objects spanning the grid
+  /// @param [in] values The values of all bins (including the under- and
+  ///                    overflow bins)
+  /// @param [in] release The release of the values when the last copy of the
+  ///                     grid is gone, e.g. the unmapping of the file
+  Grid(std::tuple<Axes...> axes, T *values, std::function<void(T *)> release)
+      : m_axes(std::move(axes)), m_values(values),
+        m_storage(new GridStorage<T>()) {
+    m_storage->release = std::move(release);
   }
 
   /// Copy constructor
   ///
-  /// @param rhs is the source Grid
-  ACTS_DEVICE_FUNC Grid(const Grid &rhs) : m_axes(rhs.m_axes) {
-    m_values = new T[rhs.size()];
-    memcpy(m_values, rhs.m_values, sizeof(T) * rhs.size());
+  /// @param rhs is the source Grid, whose values are shared
+  ACTS_DEVICE_FUNC Grid(const Grid &rhs)
+      : m_axes(rhs.m_axes), m_values(rhs.m_values) {
+#ifndef __CUDA_ARCH__
+    m_storage = rhs.m_storage;
+    acquire();
+#endif
+  }
+
+  /// Move constructor
+  ///
+  /// @param rhs is the source Grid, which is left without values
+  ACTS_DEVICE_FUNC Grid(Grid &&rhs)
+      : m_axes(std::move(rhs.m_axes)), m_values(rhs.m_values),
+        m_storage(rhs.m_storage) {
+    rhs.m_values = nullptr;
+    rhs.m_storage = nullptr;
   }
 
   /// Assignment constructor
   ///
-  /// @param rhs is the source Grid
+  /// @param rhs is the source Grid, whose values are shared
   ACTS_DEVICE_FUNC Grid &operator=(const Grid &rhs) {
-    m_axes = rhs.m_axes;
-    m_values = new T[rhs.size()];
-    memcpy(m_values, rhs.m_values, sizeof(T) * rhs.size());
+    if (this != &rhs) {
+#ifndef __CUDA_ARCH__
+      release();
+      m_storage = rhs.m_storage;
+      acquire();
+#endif
+      m_axes = rhs.m_axes;
+      m_values = rhs.m_values;
+    }
+    return (*this);
+  }
+
+  /// Move assignment
+  ///
+  /// @param rhs is the source Grid, which is left without values
+  ACTS_DEVICE_FUNC Grid &operator=(Grid &&rhs) {
+    if (this != &rhs) {
+#ifndef __CUDA_ARCH__
+      release();
+#endif
+      m_axes = std::move(rhs.m_axes);
+      m_values = rhs.m_values;
+      m_storage = rhs.m_storage;
+      rhs.m_values = nullptr;
+      rhs.m_storage = nullptr;
+    }
     return (*this);
   }
 
   /// @brief default destructor
   ///
-  ACTS_DEVICE_FUNC ~Grid() { delete[] m_values; }
+  /// @note The values are released with the last copy on the host
+  ACTS_DEVICE_FUNC ~Grid() {
+#ifndef __CUDA_ARCH__
+    release();
+#endif
+  }
+
+  /// @return The number of grids sharing the values (0 on the device)
+  size_t useCount() const {
+    return m_storage == nullptr ? 0 : m_storage->refCount.load();
+  }
 
   /// @brief access value stored in bin for a given point
   ///
@@ -88,6 +174,7 @@ public:
   //
   template <class Point>
   ACTS_DEVICE_FUNC reference atPosition(const Point &point) {
+    detach();
     return reference(m_values[globalBinFromPosition(point)].data());
   }
 
@@ -116,6 +203,7 @@ public:
   /// @return reference to value stored in bin containing the given
   ///         point
   ACTS_DEVICE_FUNC reference at(size_t bin) {
+    detach();
     return reference(m_values[bin].data());
   }
 
@@ -138,6 +226,7 @@ public:
   /// @pre All local bin indices must be a valid index for the corresponding
   ///      axis (including the under-/overflow bin for this axis).
   ACTS_DEVICE_FUNC reference atLocalBins(const index_t &localBins) {
+    detach();
     return reference(m_values[globalBinFromLocalBins(localBins)].data());
   }
 
@@ -413,13 +502,50 @@ public:
   /// @brief Get a non-const reference on the underlying grid values
   ///
   /// @return grid values reference
+  /// @note The values might be shared with other copies of the grid
   ACTS_DEVICE_FUNC T *&refValues() { return m_values; }
 
 private:
   /// set of axis defining the multi-dimensional grid
   std::tuple<Axes...> m_axes;
   /// pointer to linear value store for each bin
-  T *m_values;
+  T *m_values = nullptr;
+  /// The shared owner of the values (only on the host)
+  GridStorage<T> *m_storage = nullptr;
+
+  /// Share the values of the storage
+  void acquire() {
+    if (m_storage != nullptr) {
+      m_storage->refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /// Stop sharing the values of the storage, which are released with the
+  /// last copy
+  void release() {
+    if (m_storage != nullptr and
+        m_storage->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      m_storage->release(m_values);
+      delete m_storage;
+    }
+    m_storage = nullptr;
+  }
+
+  /// Copy the values if they are shared, i.e. before they are modified
+  ACTS_DEVICE_FUNC void detach() {
+#ifndef __CUDA_ARCH__
+    if (m_storage == nullptr or m_storage->refCount.load() == 1) {
+      return;
+    }
+    const size_t nValues = size();
+    T *values = new T[nValues];
+    std::copy(m_values, m_values + nValues, values);
+    release();
+    m_values = values;
+    m_storage = new GridStorage<T>();
+    m_storage->release = [](T *values) { delete[] values; };
+#endif
+  }
 
   // Part of closestPointsIndices that goes after local bins resolution.
   // Used as an interpolation performance optimization, but not exposed as it
@@ -0,0 +1,309 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Acts {
+namespace detail {
+
+/// @brief Host-side instrumentation backend of the PUSH_RANGE/POP_RANGE macros
+///
+/// Every thread keeps a stack of open ranges together with their start time
+/// stamp (TSC if available). Popping a range accumulates the number of calls,
+/// the total/min/max latency and a latency histogram per range and thread.
+/// Optionally, the individual ranges are recorded for a Chrome trace.
+///
+/// @note Ranges are identified by their name and registered on first use
+class Profiler {
+public:
+  /// The maximum number of distinct ranges
+  static constexpr unsigned int s_maxRanges = 32;
+  /// The maximum depth of nested ranges
+  static constexpr unsigned int s_maxDepth = 32;
+  /// Sub-buckets per power of two of the latency histogram
+  static constexpr unsigned int s_subBuckets = 4;
+  /// The number of histogram buckets
+  static constexpr unsigned int s_nBuckets = 64 * s_subBuckets;
+  /// The maximum number of trace events recorded per thread
+  static constexpr size_t s_maxTraceEvents = size_t(1) << 20;
+
+  /// The time stamp counter
+  static uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+  }
+
+  /// @brief Register a range name
+  ///
+  /// @return the range id
+  static unsigned int rangeId(const char *name) {
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (unsigned int i = 0; i < reg.names.size(); ++i) {
+      if (reg.names[i] == name) {
+        return i;
+      }
+    }
+    if (reg.names.size() == s_maxRanges) {
+      // Too many ranges, collect them in the last one
+      return s_maxRanges - 1;
+    }
+    reg.names.emplace_back(name);
+    return reg.names.size() - 1;
+  }
+
+  /// Open a range on the calling thread
+  static void push(unsigned int id) {
+    auto &tp = local();
+    if (tp.depth < s_maxDepth) {
+      tp.stack[tp.depth] = {id, ticks()};
+    }
+    ++tp.depth;
+  }
+
+  /// Close the innermost range on the calling thread
+  static void pop() {
+    uint64_t stop = ticks();
+    auto &tp = local();
+    if (tp.depth == 0) {
+      return;
+    }
+    --tp.depth;
+    if (tp.depth >= s_maxDepth) {
+      return;
+    }
+    const auto &open = tp.stack[tp.depth];
+    uint64_t dt = stop - open.start;
+    auto &stats = tp.stats[open.id];
+    stats.calls++;
+    stats.total += dt;
+    stats.min = std::min(stats.min, dt);
+    stats.max = std::max(stats.max, dt);
+    stats.histogram[bucket(dt)]++;
+    if (traceEnabled()) {
+      if (tp.trace.size() < s_maxTraceEvents) {
+        tp.trace.push_back({open.id, tp.depth, open.start, dt});
+      } else {
+        tp.droppedTraceEvents++;
+      }
+    }
+  }
+
+  /// Switch on/off the recording of the individual ranges (off by default)
+  static void enableTrace(bool enable) { traceEnabled() = enable; }
+
+  /// @brief Write the per-range and per-thread summary as CSV
+  ///
+  /// The latency percentiles are estimated from the histogram, i.e. they are
+  /// upper bounds with a relative resolution of 2^(1/s_subBuckets)
+  static void writeSummaryCsv(std::ostream &os) {
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    const double nsPerTick = nanosecondsPerTick();
+    os << "range,thread,calls,total_ms,mean_ns,min_ns,max_ns,p50_ns,p90_ns,"
+          "p99_ns\n";
+    for (unsigned int id = 0; id < reg.names.size(); ++id) {
+      // The sum over all threads is written with thread = all
+      RangeStats all;
+      for (const auto &tp : reg.threads) {
+        const auto &stats = tp->stats[id];
+        if (stats.calls == 0) {
+          continue;
+        }
+        writeStats(os, reg.names[id], std::to_string(tp->thread), stats,
+                   nsPerTick);
+        all.merge(stats);
+      }
+      if (all.calls > 0) {
+        writeStats(os, reg.names[id], "all", all, nsPerTick);
+      }
+    }
+  }
+
+  /// @brief Write the recorded ranges in the Chrome trace event format
+  ///
+  /// The output can be loaded in chrome://tracing or Perfetto
+  static void writeChromeTrace(std::ostream &os) {
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    const double nsPerTick = nanosecondsPerTick();
+    const uint64_t origin = reg.origin;
+    os << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto &tp : reg.threads) {
+      for (const auto &event : tp->trace) {
+        os << (first ? "" : ",\n") << "{\"name\":\"" << reg.names[event.id]
+           << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tp->thread
+           << ",\"ts\":" << (event.start - origin) * nsPerTick * 1e-3
+           << ",\"dur\":" << event.duration * nsPerTick * 1e-3 << "}";
+        first = false;
+      }
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  }
+
+  /// @return the number of trace events dropped because of a full buffer
+  static size_t droppedTraceEvents() {
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    size_t dropped = 0;
+    for (const auto &tp : reg.threads) {
+      dropped += tp->droppedTraceEvents;
+    }
+    return dropped;
+  }
+
+private:
+  struct RangeStats {
+    uint64_t calls = 0;
+    uint64_t total = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    uint32_t histogram[s_nBuckets] = {};
+
+    void merge(const RangeStats &other) {
+      calls += other.calls;
+      total += other.total;
+      min = std::min(min, other.min);
+      max = std::max(max, other.max);
+      for (unsigned int i = 0; i < s_nBuckets; ++i) {
+        histogram[i] += other.histogram[i];
+      }
+    }
+  };
+
+  struct OpenRange {
+    unsigned int id;
+    uint64_t start;
+  };
+
+  struct TraceRecord {
+    unsigned int id;
+    unsigned int depth;
+    uint64_t start;
+    uint64_t duration;
+  };
+
+  struct ThreadProfile {
+    unsigned int thread = 0;
+    unsigned int depth = 0;
+    OpenRange stack[s_maxDepth];
+    RangeStats stats[s_maxRanges];
+    std::vector<TraceRecord> trace;
+    size_t droppedTraceEvents = 0;
+  };
+
+  struct Registry {
+    std::mutex mutex;
+    std::vector<std::string> names;
+    std::vector<std::shared_ptr<ThreadProfile>> threads;
+    // The reference points for the tick calibration
+    uint64_t origin = ticks();
+    std::chrono::steady_clock::time_point originTime =
+        std::chrono::steady_clock::now();
+  };
+
+  static Registry &registry() {
+    static Registry s_registry;
+    return s_registry;
+  }
+
+  static bool &traceEnabled() {
+    static bool s_traceEnabled = false;
+    return s_traceEnabled;
+  }
+
+  // The profile of the calling thread, registered on first use
+  static ThreadProfile &local() {
+    thread_local std::shared_ptr<ThreadProfile> t_profile = [] {
+      auto profile = std::make_shared<ThreadProfile>();
+      auto &reg = registry();
+      std::lock_guard<std::mutex> lock(reg.mutex);
+      profile->thread = reg.threads.size();
+      reg.threads.push_back(profile);
+      return profile;
+    }();
+    return *t_profile;
+  }
+
+  // Log-linear histogram bucket of a latency in ticks
+  static unsigned int bucket(uint64_t dt) {
+    if (dt < s_subBuckets) {
+      return dt;
+    }
+    unsigned int msb = 63 - __builtin_clzll(dt);
+    unsigned int sub = (dt >> (msb - 2)) & (s_subBuckets - 1);
+    return (msb - 1) * s_subBuckets + sub;
+  }
+
+  // The upper edge of a histogram bucket in ticks
+  static uint64_t bucketEdge(unsigned int b) {
+    if (b < s_subBuckets) {
+      return b + 1;
+    }
+    unsigned int msb = b / s_subBuckets + 1;
+    uint64_t sub = b % s_subBuckets;
+    return ((s_subBuckets + sub + 1) << (msb - 2));
+  }
+
+  static uint64_t percentile(const RangeStats &stats, double fraction) {
+    uint64_t target = std::max<uint64_t>(1, fraction * stats.calls);
+    uint64_t sum = 0;
+    for (unsigned int b = 0; b < s_nBuckets; ++b) {
+      sum += stats.histogram[b];
+      if (sum >= target) {
+        return std::min(bucketEdge(b), stats.max);
+      }
+    }
+    return stats.max;
+  }
+
+  // Calibrate the ticks against the steady clock since the first use
+  static double nanosecondsPerTick() {
+    auto &reg = registry();
+    uint64_t dticks = ticks() - reg.origin;
+    double dns = std::chrono::duration<double, std::nano>(
+                     std::chrono::steady_clock::now() - reg.originTime)
+                     .count();
+    return dticks > 0 ? dns / dticks : 1.;
+  }
+
+  static void writeStats(std::ostream &os, const std::string &name,
+                         const std::string &thread, const RangeStats &stats,
+                         double nsPerTick) {
+    os << "\"" << name << "\"," << thread << "," << stats.calls << ","
+       << stats.total * nsPerTick * 1e-6 << ","
+       << double(stats.total) / stats.calls * nsPerTick << ","
+       << stats.min * nsPerTick << "," << stats.max * nsPerTick << ","
+       << percentile(stats, 0.5) * nsPerTick << ","
+       << percentile(stats, 0.9) * nsPerTick << ","
+       << percentile(stats, 0.99) * nsPerTick << "\n";
+  }
+};
+
+} // namespace detail
+} // namespace Acts